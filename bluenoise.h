@@ -0,0 +1,544 @@
+/*
+ *  Copyright 2018 Julius Ikkala
+ *
+ *  This file is part of img2string.
+ *
+ *  img2string is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  img2string is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with img2string.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef IMG2STRING_BLUENOISE_H
+#define IMG2STRING_BLUENOISE_H
+#include <stdint.h>
+
+/* A tileable blue noise threshold matrix, row by row. Generated with
+ * Ulichney's void-and-cluster method using a Gaussian filter with a sigma of
+ * 1.5 that wraps around the edges. Every value appears equally often.
+ */
+#define BLUENOISE_SIZE 64
+
+static const uint8_t bluenoise_table[BLUENOISE_SIZE * BLUENOISE_SIZE] = {
+    0x4B, 0x1F, 0x90, 0x50, 0xB3, 0xDA, 0x0C, 0xF9,
+    0x69, 0x01, 0x9B, 0x64, 0xBC, 0x50, 0x84, 0x62,
+    0x7C, 0x13, 0x4F, 0x27, 0xFF, 0x0D, 0xE9, 0x86,
+    0x07, 0xE6, 0x3A, 0x5D, 0xA7, 0x4D, 0x2F, 0xBB,
+    0x88, 0x22, 0xAC, 0x33, 0xF1, 0x40, 0xAD, 0x2A,
+    0xD7, 0x3E, 0x21, 0xBC, 0x73, 0xC7, 0x4F, 0xE3,
+    0xBA, 0x08, 0x64, 0x88, 0xD9, 0x02, 0xBE, 0x3C,
+    0xEA, 0x8B, 0x62, 0xD5, 0x7A, 0xE6, 0x5B, 0x34,
+    0xAC, 0x7A, 0xC3, 0xFD, 0x23, 0x9C, 0x5C, 0x8F,
+    0xD8, 0xB7, 0x3C, 0xE3, 0x23, 0xED, 0xCD, 0x1C,
+    0xF7, 0xA2, 0xC6, 0x69, 0xB3, 0x76, 0x53, 0xA8,
+    0x65, 0xBD, 0x8A, 0xFD, 0x0E, 0xCF, 0xEF, 0x01,
+    0x53, 0x78, 0xD8, 0x12, 0x8B, 0xDC, 0x60, 0xBF,
+    0x97, 0x6A, 0xA1, 0xF4, 0x04, 0x94, 0x14, 0x6C,
+    0x80, 0xCF, 0x2D, 0xB8, 0x41, 0x7D, 0xA1, 0x66,
+    0x25, 0xC4, 0x13, 0xF5, 0x4A, 0xB5, 0x10, 0xF7,
+    0xCE, 0x0A, 0x5E, 0x3D, 0x82, 0xE5, 0x47, 0x19,
+    0x2D, 0x7F, 0x54, 0xAB, 0x71, 0x05, 0x9A, 0x47,
+    0xE0, 0x32, 0x90, 0xDB, 0x1D, 0x3A, 0xC3, 0x24,
+    0xF2, 0x18, 0x30, 0xC7, 0x45, 0x81, 0x95, 0x61,
+    0xE3, 0xA4, 0x46, 0x6B, 0xC4, 0x22, 0x79, 0x00,
+    0xFF, 0x18, 0xD2, 0x60, 0x46, 0xDA, 0xB0, 0x34,
+    0xEC, 0x49, 0x9E, 0xF5, 0x5C, 0x16, 0xCC, 0xE2,
+    0x78, 0xB0, 0x3A, 0x94, 0x6E, 0x2A, 0x98, 0x67,
+    0x8A, 0x30, 0xE8, 0xA1, 0x04, 0x6A, 0xB0, 0xCC,
+    0xA0, 0xF5, 0x11, 0xDA, 0x8D, 0x3A, 0xB7, 0x76,
+    0x5D, 0x0B, 0x7A, 0x44, 0xEC, 0x99, 0x82, 0xD8,
+    0x44, 0x98, 0x75, 0xAC, 0x66, 0x26, 0xB4, 0x39,
+    0xC6, 0x16, 0x8F, 0xEC, 0x53, 0x9D, 0xE8, 0x48,
+    0x83, 0x54, 0x2F, 0xB4, 0x7D, 0x2B, 0xFC, 0x58,
+    0x97, 0x0D, 0x76, 0x21, 0xD5, 0x91, 0x31, 0x4D,
+    0x09, 0xEF, 0x5B, 0xCF, 0x1A, 0xBC, 0xD8, 0x44,
+    0xF1, 0xB3, 0x72, 0xD4, 0xBD, 0x33, 0xED, 0x73,
+    0x3E, 0x62, 0xC4, 0x2B, 0x4B, 0xFC, 0xD5, 0x26,
+    0xAA, 0xD1, 0xBB, 0x17, 0x62, 0xCA, 0x04, 0x6C,
+    0xB2, 0x57, 0xD0, 0x05, 0xDA, 0xF3, 0x11, 0x74,
+    0xFC, 0x29, 0xB0, 0x39, 0x0A, 0xB7, 0x34, 0xCA,
+    0xA9, 0xDF, 0x8E, 0xCB, 0x0C, 0xA5, 0x89, 0x1D,
+    0xCB, 0xB5, 0xE6, 0x52, 0xAE, 0x6D, 0xFE, 0xA6,
+    0x87, 0x2A, 0x9F, 0x7E, 0xFC, 0x37, 0x78, 0x16,
+    0x9D, 0x24, 0x51, 0x17, 0x90, 0x57, 0x1F, 0x88,
+    0x06, 0xE2, 0x93, 0x74, 0xA7, 0x63, 0x11, 0x95,
+    0xEA, 0x4E, 0x8B, 0xFA, 0xA4, 0x51, 0x35, 0xE8,
+    0x13, 0xF7, 0x3B, 0x8E, 0x4F, 0x9E, 0xC1, 0x44,
+    0x99, 0x67, 0xDE, 0x80, 0xF8, 0x70, 0x92, 0x0F,
+    0x6B, 0x3D, 0x14, 0xF0, 0x6A, 0x4A, 0xD4, 0x72,
+    0x40, 0x63, 0x8B, 0x36, 0x04, 0xC7, 0x1E, 0x5F,
+    0xBC, 0xD5, 0x43, 0x03, 0x54, 0xA3, 0xE2, 0x58,
+    0x6A, 0xDB, 0x87, 0x3C, 0xE1, 0xC5, 0xA4, 0xFF,
+    0xB1, 0x50, 0x14, 0xBB, 0x1D, 0xC6, 0x85, 0x3E,
+    0x6C, 0x03, 0x34, 0x6F, 0x25, 0xE1, 0xBA, 0x91,
+    0x79, 0xA4, 0x1F, 0xE3, 0x7C, 0x2C, 0x5B, 0x85,
+    0xD8, 0x03, 0x58, 0xC3, 0x21, 0x5C, 0xD3, 0x2A,
+    0xF6, 0xB8, 0x5C, 0x9D, 0x36, 0xE5, 0xB8, 0x04,
+    0xF7, 0x27, 0xDD, 0xA0, 0xEF, 0x84, 0x3E, 0xE0,
+    0x11, 0x71, 0xE7, 0xB3, 0xCB, 0x8C, 0x0F, 0xBE,
+    0x34, 0x01, 0xB6, 0xF7, 0x79, 0x0E, 0x68, 0x41,
+    0x29, 0xD5, 0x7F, 0xF6, 0x35, 0xE1, 0x56, 0xF2,
+    0xB8, 0x9D, 0xDA, 0xB3, 0x84, 0x0C, 0x65, 0x41,
+    0x29, 0xC6, 0x63, 0xB4, 0x0A, 0xCB, 0xEB, 0x17,
+    0xB6, 0x30, 0xA0, 0x46, 0x8C, 0xAD, 0xE5, 0x4C,
+    0x76, 0x8A, 0x25, 0xC4, 0x7F, 0x1B, 0x5D, 0x99,
+    0x81, 0xBE, 0x16, 0x72, 0x4C, 0xB9, 0x68, 0x95,
+    0x30, 0x4F, 0x8A, 0x1C, 0x6B, 0x2D, 0x49, 0xF8,
+    0x93, 0xCD, 0x56, 0x9B, 0x2D, 0x4E, 0xD9, 0x97,
+    0xC0, 0x5F, 0xA2, 0x45, 0x6D, 0x9E, 0x0E, 0x2D,
+    0xCB, 0x1E, 0x49, 0xEF, 0x59, 0xCF, 0xA9, 0xF2,
+    0xD6, 0x4E, 0x88, 0xFE, 0x48, 0x71, 0xA9, 0x3F,
+    0xF7, 0x79, 0xC9, 0xF0, 0x09, 0x3E, 0x16, 0x9F,
+    0xC7, 0x03, 0xE0, 0x4E, 0xFB, 0xB0, 0x2E, 0xD7,
+    0x49, 0xA6, 0x5A, 0xD5, 0x2C, 0x0F, 0xE8, 0xAD,
+    0xC7, 0xFA, 0xA1, 0x3A, 0xF1, 0xD2, 0xAD, 0x76,
+    0xE0, 0x43, 0x71, 0x1A, 0xAC, 0xEF, 0x84, 0x08,
+    0x76, 0x1F, 0xEA, 0x00, 0x8E, 0xD8, 0xB1, 0x80,
+    0x61, 0x91, 0x75, 0x13, 0x3B, 0x96, 0x1F, 0x6E,
+    0x00, 0x9E, 0x17, 0x35, 0xDA, 0x98, 0x26, 0x67,
+    0x90, 0x53, 0x1C, 0x69, 0xD9, 0xBA, 0x81, 0x63,
+    0xEC, 0x43, 0xA7, 0x6C, 0x10, 0x94, 0x78, 0xF0,
+    0x12, 0x34, 0xC7, 0x95, 0xFA, 0x87, 0x57, 0x20,
+    0x74, 0x05, 0x61, 0xBA, 0x81, 0x09, 0x5E, 0x1E,
+    0xB1, 0x0B, 0xC2, 0xE4, 0x62, 0xBC, 0x31, 0xCB,
+    0xE4, 0x3D, 0xAF, 0xC4, 0x5A, 0x25, 0x4C, 0xFA,
+    0x3F, 0xE7, 0xD3, 0xAB, 0xC1, 0xFC, 0x50, 0x8D,
+    0xBF, 0xE8, 0x76, 0xB0, 0x5E, 0x10, 0xBF, 0xE4,
+    0x0B, 0xD3, 0xAF, 0x2E, 0x98, 0x54, 0xFE, 0x32,
+    0x1D, 0x8E, 0xC0, 0x2C, 0xD2, 0x40, 0x55, 0xC1,
+    0x6E, 0xE7, 0x7C, 0x06, 0x41, 0xA9, 0xCE, 0x3C,
+    0x8F, 0xDB, 0x28, 0xE3, 0x4E, 0x9A, 0xEB, 0x87,
+    0x59, 0xFD, 0x7E, 0x26, 0x8D, 0x11, 0x49, 0x69,
+    0x99, 0x56, 0x83, 0x32, 0xEF, 0x76, 0xBC, 0x09,
+    0xA5, 0x19, 0x33, 0x5E, 0x06, 0x7E, 0x2D, 0xE1,
+    0x3D, 0x5A, 0x2B, 0xCD, 0x8E, 0xF0, 0x7F, 0x4D,
+    0x9D, 0x3A, 0x83, 0xEB, 0x73, 0x1F, 0xCE, 0xA5,
+    0x70, 0xD7, 0x5A, 0x82, 0xED, 0xB7, 0x02, 0xA2,
+    0x26, 0x4B, 0xB1, 0x5E, 0xDF, 0x6E, 0x12, 0xF5,
+    0xB8, 0x49, 0xAB, 0x78, 0x1A, 0xC6, 0x3F, 0x28,
+    0x98, 0x35, 0xA6, 0x4F, 0xD3, 0xA2, 0xF5, 0xB3,
+    0x19, 0xF9, 0x10, 0xCF, 0x93, 0x1B, 0xE2, 0x8A,
+    0x6B, 0xC2, 0x81, 0x9F, 0xE8, 0x69, 0xB8, 0x17,
+    0xAA, 0x83, 0xF4, 0x1A, 0x50, 0x3C, 0xD6, 0x2A,
+    0xB9, 0xFB, 0x5A, 0x04, 0xB6, 0x46, 0x86, 0x07,
+    0xE9, 0x3B, 0x0D, 0x9D, 0x22, 0x64, 0xDE, 0x88,
+    0xFF, 0xD0, 0x92, 0x1F, 0xBE, 0x31, 0xA2, 0x7A,
+    0x5B, 0x0C, 0xD0, 0x38, 0xFB, 0x63, 0xB6, 0xDD,
+    0x6C, 0xD5, 0x0F, 0xEE, 0x37, 0x5C, 0x7F, 0x27,
+    0xD1, 0x74, 0xAB, 0x66, 0x44, 0xA3, 0x5E, 0x36,
+    0xDA, 0x4A, 0xF7, 0x22, 0x44, 0xCA, 0x93, 0x56,
+    0xD1, 0x08, 0x98, 0xBD, 0x71, 0xAD, 0x02, 0x77,
+    0x64, 0x17, 0xA8, 0xD6, 0x33, 0xE6, 0xC5, 0x50,
+    0x92, 0xB6, 0xF8, 0x4C, 0xAE, 0x7D, 0x19, 0x3D,
+    0x60, 0x0D, 0x38, 0xF5, 0x83, 0x4C, 0xEA, 0x25,
+    0xDE, 0x9E, 0x6D, 0x8B, 0xA7, 0x02, 0x79, 0x15,
+    0x46, 0xBF, 0x5F, 0x7C, 0xC8, 0x0B, 0xE0, 0x40,
+    0x8E, 0x4E, 0x2D, 0xDE, 0x06, 0xFC, 0xCA, 0x24,
+    0xAF, 0x03, 0x91, 0x58, 0xDD, 0x0C, 0x35, 0xEB,
+    0x74, 0x43, 0x63, 0xDD, 0x2E, 0xFA, 0x9B, 0xCC,
+    0xE6, 0x91, 0x48, 0x7D, 0x9A, 0x61, 0x1A, 0xAA,
+    0x67, 0x29, 0x74, 0xD4, 0x33, 0xF4, 0xBD, 0x9A,
+    0xC5, 0x79, 0xA6, 0x68, 0xCD, 0x00, 0x90, 0xC9,
+    0x43, 0x18, 0xE9, 0x24, 0x4D, 0xD3, 0x90, 0xF4,
+    0x29, 0x86, 0xB2, 0x1F, 0x9C, 0x70, 0xBD, 0xA8,
+    0x04, 0xE9, 0xC0, 0x86, 0xB7, 0x74, 0x52, 0x9A,
+    0xE8, 0x77, 0xD1, 0xB3, 0x72, 0xA3, 0x84, 0xB2,
+    0x23, 0xF7, 0xA5, 0x12, 0x86, 0x5F, 0x21, 0x51,
+    0x38, 0xBC, 0x27, 0xEF, 0x0E, 0x76, 0xF8, 0x3E,
+    0xE2, 0x14, 0xC1, 0x8D, 0x08, 0x6C, 0x50, 0x29,
+    0xEE, 0x4A, 0xD7, 0x16, 0x9C, 0x56, 0xB3, 0x66,
+    0x84, 0xB8, 0x5F, 0xC2, 0xF0, 0x31, 0x57, 0xA1,
+    0xE1, 0x0A, 0xFA, 0x41, 0xE8, 0x2F, 0x52, 0xFE,
+    0x67, 0x9D, 0x1A, 0x57, 0x3B, 0x1F, 0x89, 0x10,
+    0x41, 0x64, 0x2E, 0x12, 0x3E, 0xFD, 0x1A, 0x4D,
+    0xD6, 0x89, 0x36, 0xCA, 0x48, 0xB8, 0xEC, 0x8D,
+    0x0B, 0x6D, 0xCD, 0x55, 0xB4, 0xD3, 0x2B, 0xBB,
+    0x7C, 0x9C, 0x45, 0x5A, 0xE7, 0x9F, 0xCE, 0x8B,
+    0x05, 0xB2, 0x2B, 0xE7, 0x3D, 0xF3, 0x2E, 0x11,
+    0xF9, 0x32, 0x9A, 0x0A, 0x6F, 0xAE, 0x1B, 0xC5,
+    0x3C, 0x75, 0xA4, 0x57, 0x89, 0xD4, 0x15, 0x84,
+    0x37, 0xCB, 0x78, 0xF2, 0xAA, 0xE1, 0xBF, 0xF3,
+    0xA9, 0xC5, 0xEE, 0x86, 0xBB, 0x5C, 0xC9, 0x6D,
+    0x01, 0xBE, 0x57, 0xE8, 0x9C, 0x06, 0x79, 0xC8,
+    0xAC, 0xF9, 0x87, 0x1F, 0xA1, 0x43, 0x8A, 0x59,
+    0x0B, 0xCA, 0xFB, 0x23, 0xB3, 0x38, 0x17, 0xDF,
+    0x71, 0x5A, 0x94, 0x7E, 0x62, 0xC3, 0x79, 0xD8,
+    0xA5, 0x52, 0xE4, 0x7E, 0x40, 0xDC, 0x82, 0x63,
+    0x91, 0xD1, 0x2C, 0xBF, 0x00, 0x63, 0xB4, 0x98,
+    0x20, 0x4B, 0xD7, 0x0C, 0x94, 0x68, 0x33, 0x5A,
+    0x7C, 0x16, 0x53, 0x9D, 0xE1, 0x24, 0x8C, 0xEE,
+    0x9B, 0x2B, 0x7C, 0x1D, 0x6F, 0xDB, 0x2B, 0x42,
+    0x5D, 0x13, 0x3B, 0xE5, 0x64, 0x02, 0xDB, 0xA5,
+    0xEB, 0x38, 0x6B, 0x86, 0xDB, 0x66, 0x81, 0xBA,
+    0x41, 0xFB, 0xC9, 0x1D, 0xAE, 0x08, 0x92, 0x44,
+    0x6D, 0x19, 0xC9, 0x25, 0x96, 0xBA, 0x04, 0xF3,
+    0x50, 0x18, 0x6B, 0xDE, 0x94, 0xF6, 0x42, 0xC4,
+    0xEE, 0xA5, 0x60, 0x2D, 0x47, 0xC8, 0x01, 0xA2,
+    0x26, 0xDC, 0x38, 0x6F, 0x05, 0x49, 0xAC, 0x35,
+    0x62, 0xDF, 0xA8, 0xFF, 0x3B, 0x61, 0xA8, 0xF3,
+    0x96, 0xD9, 0x75, 0xBC, 0x92, 0xFE, 0x6F, 0x24,
+    0x4B, 0x95, 0x1B, 0xA8, 0x00, 0x47, 0xF4, 0x22,
+    0xA5, 0x12, 0x39, 0xE2, 0x4E, 0xD4, 0x25, 0xBA,
+    0xE9, 0x88, 0xAF, 0x4A, 0xFF, 0x5B, 0x36, 0xA9,
+    0xC2, 0xE9, 0xB0, 0x4B, 0x1C, 0x7B, 0x2B, 0x6E,
+    0x07, 0x7C, 0xBB, 0xF8, 0x73, 0xDB, 0x84, 0xFF,
+    0xBD, 0x8E, 0xAD, 0xF7, 0xCC, 0x7B, 0xDA, 0x11,
+    0xBC, 0x45, 0x0C, 0x8C, 0xB9, 0xD2, 0x0E, 0x80,
+    0x21, 0x52, 0xA5, 0x2B, 0x4D, 0x18, 0xCC, 0xB1,
+    0x7B, 0xC3, 0xE0, 0x53, 0xBF, 0xD1, 0x95, 0x5C,
+    0x7C, 0xC0, 0x67, 0x87, 0x9F, 0x73, 0xFD, 0x5E,
+    0x38, 0x02, 0x66, 0xD3, 0x10, 0x77, 0xDF, 0x24,
+    0x86, 0x0E, 0x78, 0x35, 0xA2, 0xE7, 0xD0, 0x54,
+    0xE1, 0x3B, 0x8F, 0x11, 0x9F, 0x20, 0x52, 0x3A,
+    0x6B, 0x4A, 0x0D, 0x61, 0x2E, 0x99, 0x59, 0xFA,
+    0x85, 0x6D, 0xCE, 0x53, 0x1B, 0x74, 0x44, 0xE1,
+    0xB4, 0xCF, 0x08, 0xF0, 0xC4, 0x82, 0x36, 0x5E,
+    0x08, 0xF5, 0x2D, 0x74, 0x8A, 0x31, 0x0D, 0xE7,
+    0x49, 0xD7, 0x03, 0xEF, 0x29, 0x42, 0x10, 0xAC,
+    0xCF, 0x9A, 0xEE, 0x2D, 0x8D, 0xC4, 0x9C, 0x67,
+    0x42, 0x99, 0xFC, 0xCB, 0x5F, 0xB7, 0x10, 0x85,
+    0xAE, 0x21, 0xC7, 0x59, 0xEA, 0xB7, 0x96, 0xD3,
+    0x19, 0xC5, 0xEA, 0x89, 0xB8, 0x1A, 0xC6, 0x3B,
+    0x24, 0xB0, 0xF2, 0x33, 0xA1, 0xED, 0x91, 0x5F,
+    0x32, 0x6E, 0x8A, 0x41, 0x68, 0x9C, 0xE9, 0xD5,
+    0x8E, 0x41, 0xB7, 0x18, 0xFF, 0x60, 0x9E, 0xB5,
+    0x2C, 0x8F, 0xA9, 0x55, 0xC4, 0xDC, 0x94, 0x7E,
+    0x22, 0x43, 0x73, 0xA8, 0x55, 0x3C, 0x15, 0xF0,
+    0xD4, 0x2C, 0x56, 0x07, 0x8D, 0x26, 0x46, 0x9B,
+    0xFD, 0x6A, 0xDB, 0x40, 0x2A, 0x65, 0x07, 0xEF,
+    0x77, 0x9C, 0x27, 0x40, 0xE4, 0x50, 0x74, 0xA5,
+    0xE8, 0x03, 0x94, 0x5B, 0xC8, 0x28, 0xBF, 0x00,
+    0xFC, 0x9A, 0x1F, 0xD7, 0xAF, 0x0C, 0x52, 0x26,
+    0xA7, 0x70, 0x57, 0xA0, 0xD9, 0x3D, 0xC8, 0x70,
+    0x1A, 0xF8, 0x37, 0x77, 0x14, 0xB5, 0x65, 0xF3,
+    0x53, 0xDD, 0xC1, 0x1C, 0xF5, 0xD9, 0xAF, 0x5A,
+    0x73, 0xBD, 0xA8, 0xDE, 0x6B, 0xF2, 0xC5, 0x5D,
+    0x33, 0x04, 0x89, 0xA7, 0x7A, 0xC8, 0x8C, 0x30,
+    0xAE, 0x5B, 0xCF, 0x81, 0xA8, 0x07, 0xD2, 0x8A,
+    0x63, 0x46, 0x7C, 0xDE, 0x16, 0x86, 0x52, 0xAB,
+    0xC9, 0x46, 0xE6, 0x60, 0x30, 0xFA, 0x7C, 0xC0,
+    0x14, 0xF1, 0xCD, 0x04, 0x80, 0x20, 0xEC, 0x4D,
+    0x83, 0xBD, 0x60, 0xE4, 0x8B, 0x4B, 0x32, 0x05,
+    0xB1, 0x8F, 0x0D, 0x60, 0x7A, 0x29, 0x88, 0x02,
+    0xEA, 0x1D, 0x49, 0x82, 0x38, 0xAD, 0x19, 0x7B,
+    0xD7, 0xB8, 0x4B, 0xE5, 0x0E, 0xFB, 0x51, 0xDE,
+    0x42, 0x0A, 0xF9, 0x1D, 0x69, 0xF1, 0x35, 0x13,
+    0xDC, 0xBB, 0x2E, 0xAB, 0x6B, 0xF5, 0x36, 0x72,
+    0x13, 0x82, 0xA7, 0x11, 0xBA, 0x91, 0x3D, 0xE2,
+    0x61, 0x35, 0x91, 0x4B, 0xB0, 0x69, 0x93, 0x06,
+    0xDE, 0xA0, 0x0E, 0xCE, 0x24, 0xED, 0xA3, 0xD1,
+    0x6A, 0x39, 0xE9, 0x9C, 0xB5, 0x4C, 0xCF, 0xA1,
+    0x3A, 0x93, 0xF6, 0x13, 0xD8, 0x92, 0x51, 0xEA,
+    0x9F, 0x16, 0x70, 0xC2, 0x38, 0x9D, 0x19, 0x6E,
+    0xBA, 0x95, 0x75, 0xC0, 0x56, 0x91, 0xB4, 0x4D,
+    0x9A, 0x1E, 0xFB, 0x4F, 0x09, 0xD0, 0x90, 0xE2,
+    0x5A, 0xF1, 0x37, 0x79, 0xD3, 0x6C, 0x03, 0xA3,
+    0x85, 0xB9, 0xDD, 0x2A, 0xF3, 0xC1, 0x36, 0xCD,
+    0x58, 0x2E, 0x47, 0x97, 0x6B, 0xBD, 0x7C, 0x18,
+    0xF9, 0x85, 0x23, 0xD3, 0x3B, 0xFB, 0x19, 0x64,
+    0xC9, 0x57, 0x78, 0xBE, 0x63, 0x04, 0xCA, 0x28,
+    0x40, 0x8C, 0xF7, 0x21, 0x63, 0xB3, 0x83, 0xD1,
+    0x29, 0xE7, 0x4A, 0x37, 0xD8, 0x27, 0x77, 0xE7,
+    0x69, 0xD0, 0x82, 0x96, 0xBC, 0x42, 0x1B, 0xB6,
+    0x29, 0x98, 0xC1, 0x52, 0x22, 0xF5, 0x48, 0xCC,
+    0x22, 0x53, 0x0B, 0x7C, 0x5D, 0x12, 0xA4, 0x79,
+    0xFD, 0xAF, 0x7F, 0xF3, 0x15, 0x3B, 0x59, 0x9B,
+    0x48, 0xC0, 0x54, 0x71, 0x07, 0x93, 0x7F, 0xB1,
+    0x08, 0xE5, 0x20, 0xA1, 0x33, 0xFC, 0x76, 0xA9,
+    0x66, 0xD2, 0x56, 0x94, 0xDB, 0x45, 0xF1, 0x5B,
+    0x10, 0x85, 0xAD, 0x01, 0x9C, 0xFE, 0x17, 0xC3,
+    0x3A, 0x04, 0x5D, 0x33, 0xEE, 0x74, 0xA7, 0x4B,
+    0xD1, 0x6B, 0x06, 0xDD, 0xAD, 0x99, 0x5D, 0xEC,
+    0x74, 0xAA, 0xFB, 0xCF, 0x9B, 0x41, 0xE6, 0x23,
+    0x66, 0x09, 0xC9, 0x52, 0xAB, 0xE5, 0xCF, 0x2B,
+    0xE0, 0x0B, 0xA9, 0xE5, 0xC5, 0x5B, 0xEC, 0x2F,
+    0x70, 0xAC, 0x40, 0xD1, 0x8E, 0x48, 0xB8, 0x10,
+    0xED, 0x35, 0x00, 0xBD, 0x76, 0x13, 0x30, 0xC3,
+    0xA1, 0x66, 0xF5, 0xCE, 0x7F, 0x62, 0x48, 0xA6,
+    0x8F, 0xEB, 0xB2, 0xCC, 0x12, 0x60, 0xE4, 0x81,
+    0x16, 0xFE, 0x8D, 0x40, 0x7D, 0x16, 0x31, 0xB5,
+    0x10, 0x42, 0x8F, 0x31, 0x6E, 0xC8, 0x51, 0x8A,
+    0xBD, 0x3F, 0xDF, 0x28, 0x86, 0x01, 0x73, 0x8D,
+    0xB2, 0x64, 0x81, 0x32, 0x9F, 0x20, 0x45, 0xDA,
+    0x51, 0x85, 0xF7, 0x65, 0x16, 0xDC, 0x59, 0x96,
+    0x7D, 0xC5, 0xA2, 0x28, 0xE9, 0xAE, 0x92, 0x4F,
+    0xE1, 0x34, 0x18, 0x58, 0x23, 0xB2, 0xD6, 0x10,
+    0x70, 0x52, 0x22, 0x7B, 0xA0, 0x2C, 0xC1, 0x39,
+    0xA2, 0x54, 0x26, 0xE6, 0xBC, 0x6A, 0xD4, 0x8A,
+    0xE2, 0x64, 0xBE, 0x1A, 0xE0, 0x05, 0xA9, 0xF1,
+    0x1B, 0x95, 0x6F, 0xA3, 0x5E, 0xF6, 0xBF, 0x1C,
+    0x40, 0xFF, 0x19, 0x4C, 0xEF, 0x68, 0xBD, 0x9B,
+    0xC6, 0x2A, 0x0D, 0xB4, 0x80, 0x2D, 0xF2, 0x1E,
+    0x43, 0xE2, 0x54, 0x88, 0x42, 0x62, 0xF6, 0x04,
+    0x7B, 0xB3, 0x91, 0xC4, 0x3F, 0xEA, 0x85, 0x34,
+    0xF8, 0xAB, 0xDC, 0x4B, 0xF6, 0x89, 0x01, 0xEE,
+    0x6E, 0xB4, 0xCC, 0x61, 0x0B, 0xF2, 0x44, 0xA2,
+    0x29, 0x80, 0xEE, 0x57, 0xB3, 0x84, 0x38, 0x73,
+    0xD8, 0x4E, 0xEA, 0x0F, 0xB7, 0x49, 0x30, 0x6C,
+    0xC8, 0x96, 0xD6, 0xB8, 0x88, 0x00, 0x7B, 0x17,
+    0xE0, 0x8E, 0xEC, 0x54, 0xCE, 0xA0, 0xC2, 0x71,
+    0xB2, 0x0A, 0x6B, 0xD5, 0x10, 0xC9, 0x71, 0x27,
+    0xD6, 0x45, 0xE5, 0x71, 0xA3, 0x07, 0x67, 0xC2,
+    0x1C, 0x92, 0x3A, 0x0F, 0xC7, 0x5B, 0x9B, 0x4D,
+    0xDA, 0x0F, 0x96, 0x32, 0xA7, 0x86, 0x1E, 0x58,
+    0xCB, 0x00, 0x3E, 0x99, 0x23, 0xF8, 0x5D, 0x11,
+    0xB2, 0x29, 0xC6, 0x3B, 0x8E, 0xD7, 0xA0, 0xE7,
+    0x53, 0x09, 0x72, 0x2E, 0xA5, 0xD2, 0xF6, 0x36,
+    0x6A, 0x47, 0xA6, 0x75, 0x3B, 0x03, 0x4D, 0x8F,
+    0xE9, 0x38, 0xA5, 0xFA, 0x95, 0x37, 0xA3, 0xBA,
+    0x8D, 0x60, 0x0C, 0x2D, 0xF5, 0x4F, 0x99, 0xE1,
+    0x5B, 0x79, 0xD0, 0x69, 0xB4, 0x34, 0xCE, 0x21,
+    0x87, 0x42, 0x7A, 0xF9, 0x4E, 0xDC, 0xC1, 0x77,
+    0xFF, 0xAD, 0xDA, 0x6C, 0xC4, 0x45, 0xA0, 0xCF,
+    0x8C, 0x64, 0x7F, 0xFD, 0x21, 0x63, 0x0D, 0x84,
+    0xAE, 0x39, 0xF2, 0x5E, 0x1D, 0x44, 0x5A, 0xA3,
+    0xB9, 0x06, 0xD4, 0x21, 0xE3, 0x67, 0xFF, 0x29,
+    0x5F, 0xBF, 0x18, 0x77, 0x22, 0x5B, 0xEE, 0x4D,
+    0x1B, 0xFD, 0xAB, 0xCD, 0x89, 0xBC, 0x23, 0x3E,
+    0xB0, 0x0A, 0xE7, 0xA4, 0x1C, 0x7E, 0xFC, 0x65,
+    0xBE, 0xE9, 0x1B, 0xB5, 0x70, 0x06, 0x3A, 0x93,
+    0x19, 0x4E, 0x30, 0x8B, 0x09, 0xDE, 0x7B, 0x30,
+    0xEF, 0x05, 0xAB, 0x57, 0xBF, 0x77, 0xF1, 0x27,
+    0xDF, 0x91, 0xC2, 0x7E, 0xE6, 0xC9, 0x8D, 0x23,
+    0xFC, 0x7E, 0x36, 0xBC, 0x83, 0x97, 0xAF, 0x12,
+    0xD2, 0x84, 0x50, 0xCE, 0xB2, 0xE2, 0x0A, 0x7A,
+    0xC3, 0x31, 0x7D, 0x42, 0x15, 0x6C, 0xD6, 0x7E,
+    0xFD, 0x54, 0x2C, 0x88, 0x44, 0xDD, 0x0C, 0xA6,
+    0x33, 0x99, 0x5F, 0xCE, 0x2A, 0xA2, 0xE7, 0x62,
+    0xBB, 0x72, 0xA5, 0xF0, 0x60, 0xB1, 0x18, 0x51,
+    0xB9, 0x3C, 0xE0, 0x19, 0x9C, 0x39, 0xC9, 0x4E,
+    0x67, 0x19, 0x4A, 0x05, 0xB0, 0x68, 0x11, 0xD9,
+    0x4F, 0x9C, 0x61, 0xF1, 0x0C, 0x45, 0xDB, 0x7B,
+    0x40, 0x98, 0xF4, 0x2F, 0x69, 0x8C, 0x3D, 0xDA,
+    0x97, 0x65, 0xE9, 0x9F, 0x59, 0xF2, 0x05, 0xA1,
+    0x34, 0xC5, 0x9B, 0xF4, 0x5F, 0xBA, 0x75, 0x51,
+    0xE1, 0x03, 0x44, 0xED, 0x8D, 0x53, 0xCA, 0x23,
+    0xF3, 0x0B, 0xD0, 0x22, 0x40, 0x83, 0xFB, 0x6D,
+    0xD2, 0x98, 0x79, 0x4A, 0xD6, 0x02, 0xA5, 0x81,
+    0xB9, 0xD7, 0xA0, 0xFA, 0x30, 0x98, 0x3E, 0x72,
+    0x29, 0xCC, 0x15, 0xAB, 0x55, 0xC8, 0x30, 0x64,
+    0xE6, 0x01, 0xAB, 0x4A, 0x16, 0xC7, 0xA1, 0x26,
+    0x51, 0x01, 0xD3, 0x1E, 0xB9, 0x95, 0x48, 0xCC,
+    0x65, 0x1D, 0x75, 0x03, 0xCD, 0x37, 0x92, 0x24,
+    0xC7, 0x7D, 0xAE, 0x6D, 0x13, 0xB2, 0x78, 0x47,
+    0x9B, 0x82, 0x59, 0xB6, 0x92, 0xCA, 0x25, 0xA6,
+    0x0F, 0x5C, 0x2A, 0xEB, 0x85, 0x59, 0xFA, 0x12,
+    0x3F, 0x25, 0x6C, 0x87, 0x56, 0xC3, 0xEB, 0xB2,
+    0x8F, 0xDF, 0x3F, 0x88, 0x6F, 0xEB, 0x18, 0xA2,
+    0xC0, 0x27, 0x6F, 0xDC, 0x81, 0xFC, 0x59, 0xBD,
+    0xEC, 0xA7, 0x70, 0x34, 0xE3, 0x78, 0x2B, 0xEC,
+    0x8C, 0xBD, 0xE4, 0x50, 0xAA, 0x14, 0xF2, 0xB1,
+    0x64, 0xFA, 0x22, 0xD4, 0x3B, 0xF8, 0x08, 0xE3,
+    0x2E, 0xD8, 0x3C, 0xE8, 0x14, 0x4D, 0xE3, 0x37,
+    0x8F, 0xF4, 0xBA, 0xA8, 0x1D, 0xC3, 0x6E, 0xDC,
+    0x90, 0xEE, 0xCB, 0x0D, 0xE3, 0x1F, 0x7D, 0x09,
+    0x4C, 0x6B, 0xBB, 0xF9, 0x24, 0x93, 0xB7, 0x80,
+    0x54, 0xF0, 0x90, 0xB7, 0x37, 0x09, 0x74, 0x1A,
+    0x84, 0x43, 0xC1, 0x8E, 0x51, 0x17, 0xAD, 0x58,
+    0x0F, 0x42, 0x80, 0x2A, 0x6D, 0xE2, 0x81, 0x46,
+    0x0E, 0x95, 0x55, 0x85, 0xA0, 0x66, 0xC4, 0x89,
+    0xAC, 0x68, 0x0E, 0xA3, 0x70, 0xBB, 0x60, 0x7F,
+    0xDA, 0x46, 0x08, 0x66, 0x3F, 0x96, 0x2C, 0x4C,
+    0xAF, 0x5C, 0x37, 0xA3, 0x47, 0xAC, 0x5E, 0xF5,
+    0x17, 0xA1, 0x32, 0x03, 0xD6, 0x4F, 0x39, 0x0A,
+    0xCB, 0x3F, 0x12, 0x5D, 0xD3, 0x97, 0xE4, 0xAF,
+    0x2D, 0xF9, 0x0C, 0x64, 0xC8, 0xF6, 0x83, 0xDB,
+    0xB6, 0x99, 0xF2, 0xD3, 0xA0, 0x3C, 0x5C, 0xCA,
+    0xDC, 0x35, 0xC2, 0x17, 0xDF, 0x2A, 0x57, 0x1B,
+    0x4C, 0xBE, 0xFD, 0x7D, 0x2B, 0xF0, 0x02, 0xB2,
+    0x21, 0x72, 0xC7, 0x8B, 0xD9, 0xED, 0xB7, 0x07,
+    0x7F, 0x18, 0xC1, 0x6F, 0x84, 0xD3, 0x31, 0xC7,
+    0xB4, 0xE6, 0x83, 0x65, 0x9E, 0xC2, 0x77, 0xFC,
+    0x8C, 0x69, 0xE3, 0xA8, 0x25, 0x53, 0x3D, 0xCD,
+    0x5F, 0x96, 0xDD, 0xA6, 0x2E, 0x45, 0x03, 0x6D,
+    0x37, 0x24, 0x56, 0x07, 0xC0, 0x18, 0x8C, 0x28,
+    0x9D, 0x77, 0xF0, 0x4A, 0xB9, 0x75, 0xED, 0x99,
+    0xD5, 0x25, 0x91, 0x54, 0xD0, 0x41, 0x99, 0xD4,
+    0x51, 0xA0, 0xFE, 0x33, 0x13, 0x56, 0x73, 0xCE,
+    0xF8, 0x97, 0xE0, 0x23, 0xFF, 0x06, 0x97, 0x75,
+    0x23, 0x58, 0xCC, 0x45, 0xE8, 0x17, 0x61, 0xDA,
+    0x1F, 0x9E, 0x32, 0x7A, 0xC2, 0xF7, 0x6E, 0x04,
+    0x7E, 0x46, 0x23, 0x73, 0xD2, 0x90, 0xBD, 0xA0,
+    0xF9, 0xCD, 0x76, 0x90, 0x64, 0xFF, 0xAF, 0xEC,
+    0x02, 0x65, 0xA6, 0x0F, 0x90, 0x3A, 0xAF, 0x00,
+    0x6D, 0x42, 0xE2, 0x0A, 0xA9, 0x86, 0x68, 0x31,
+    0xEA, 0x0B, 0x5E, 0xB4, 0x80, 0xA9, 0x20, 0x3C,
+    0x61, 0x2F, 0x53, 0xB1, 0x42, 0x62, 0xDF, 0x46,
+    0xF9, 0x0D, 0x99, 0x2A, 0xB1, 0x89, 0x30, 0xAA,
+    0x51, 0xBE, 0xF4, 0x0C, 0x8C, 0x1D, 0xB3, 0x9F,
+    0xD7, 0xBB, 0xF1, 0x10, 0x59, 0xED, 0x1E, 0x5F,
+    0x4B, 0x11, 0xAC, 0xE5, 0x47, 0x2F, 0x73, 0x4E,
+    0xBE, 0x3C, 0xD3, 0x58, 0xFD, 0x21, 0xCF, 0x82,
+    0xF6, 0xB2, 0x62, 0xC0, 0x23, 0xF9, 0x10, 0xC6,
+    0x78, 0x8F, 0x28, 0xD2, 0x45, 0xF4, 0xD7, 0x89,
+    0xA4, 0xC6, 0x0F, 0x87, 0xCD, 0x1B, 0xAF, 0x8C,
+    0xC0, 0x6B, 0xEC, 0x7A, 0x08, 0xF4, 0x47, 0xD0,
+    0x02, 0x72, 0x41, 0x61, 0xDD, 0x4A, 0xE6, 0x36,
+    0x13, 0x55, 0x9D, 0x86, 0xB0, 0x36, 0x77, 0xE0,
+    0xC3, 0x89, 0x3D, 0x1F, 0xD4, 0x97, 0xC8, 0x16,
+    0x87, 0xE7, 0x2B, 0x81, 0xC1, 0x68, 0x48, 0xA4,
+    0x32, 0x13, 0x8E, 0x39, 0x75, 0xDD, 0x58, 0xAC,
+    0x42, 0xB9, 0xE7, 0x6D, 0x0D, 0x94, 0x52, 0x02,
+    0xE3, 0x76, 0xF4, 0x69, 0x9B, 0xED, 0x72, 0x34,
+    0x50, 0xAA, 0x3E, 0xD7, 0x57, 0xC5, 0x99, 0x7F,
+    0xE7, 0x94, 0xD6, 0xA9, 0x2F, 0x98, 0x64, 0x84,
+    0xFE, 0x6F, 0x2A, 0xE6, 0x48, 0xCA, 0x0C, 0x98,
+    0x29, 0x6C, 0xF0, 0xB9, 0x79, 0x0B, 0x5C, 0xDE,
+    0x9B, 0x68, 0xB3, 0x06, 0x9B, 0xDF, 0x17, 0x5C,
+    0xD9, 0x78, 0xEA, 0xCB, 0xA2, 0x47, 0x95, 0x25,
+    0xF4, 0x15, 0x54, 0xA4, 0xC7, 0x32, 0x71, 0xBA,
+    0x26, 0x47, 0xB7, 0x39, 0x24, 0x56, 0x00, 0xD9,
+    0x14, 0x86, 0x1C, 0xB7, 0x2C, 0x6A, 0x1A, 0x38,
+    0x5C, 0x28, 0x12, 0x7E, 0xBA, 0x07, 0xC9, 0x1E,
+    0xAD, 0x3E, 0xCD, 0x00, 0x66, 0x8C, 0xFB, 0xB4,
+    0x46, 0xD8, 0x03, 0x9D, 0x50, 0xF3, 0xAB, 0x27,
+    0x45, 0x1A, 0xF6, 0x51, 0x39, 0x73, 0xEF, 0x90,
+    0xC4, 0x28, 0x51, 0x04, 0x66, 0x18, 0xD0, 0x6F,
+    0x84, 0xD7, 0x38, 0x7E, 0x1E, 0xDE, 0x9D, 0xFD,
+    0x5D, 0x97, 0x0A, 0xDD, 0xAA, 0xC5, 0x7D, 0x9D,
+    0xE5, 0xCA, 0x61, 0x92, 0xDD, 0xA4, 0xFF, 0xBF,
+    0xAC, 0xEE, 0xCA, 0x4D, 0xF9, 0x73, 0xEA, 0x57,
+    0x8D, 0xDF, 0x7B, 0xB9, 0xA4, 0x2E, 0x55, 0x14,
+    0x81, 0xA6, 0x61, 0x26, 0x8C, 0x39, 0xCB, 0x70,
+    0xEB, 0xA6, 0x7D, 0xD5, 0xB6, 0x27, 0xAA, 0x07,
+    0x43, 0xB5, 0x9A, 0xF7, 0xAE, 0xE3, 0x32, 0xB6,
+    0x01, 0x9E, 0x63, 0xF2, 0xB0, 0x5A, 0x3F, 0x18,
+    0xCC, 0x83, 0xF0, 0x65, 0x8B, 0x40, 0xFB, 0x2B,
+    0x71, 0x35, 0xF8, 0x49, 0x11, 0x78, 0x4F, 0x09,
+    0x6D, 0x3E, 0x8E, 0x65, 0x22, 0x3F, 0xA3, 0x32,
+    0xC2, 0x14, 0x4C, 0x22, 0xF3, 0xD0, 0x71, 0xE8,
+    0xC9, 0x34, 0xF7, 0xBF, 0xDF, 0x66, 0x18, 0x88,
+    0xC0, 0x31, 0x5F, 0x0F, 0x8B, 0xCD, 0x56, 0x82,
+    0xF3, 0x6E, 0x1C, 0x7F, 0x40, 0x8B, 0x5C, 0xFE,
+    0x50, 0xBF, 0x24, 0xCC, 0x06, 0x8B, 0xE9, 0x79,
+    0xAE, 0x2F, 0x50, 0x1E, 0xD4, 0x0E, 0x5E, 0xB5,
+    0x96, 0x07, 0xAE, 0x82, 0xEB, 0x34, 0xD2, 0x88,
+    0xDE, 0xA2, 0x16, 0xB4, 0xE1, 0x92, 0xD8, 0x0E,
+    0x69, 0xEF, 0x98, 0x60, 0x80, 0x08, 0x3E, 0x93,
+    0x5A, 0x19, 0x7A, 0x49, 0x0F, 0x9F, 0xFD, 0x4C,
+    0x01, 0x94, 0xE5, 0x45, 0xFC, 0x6A, 0x19, 0xE1,
+    0x2F, 0xCA, 0x59, 0xDC, 0x26, 0xC4, 0x0D, 0x9A,
+    0x3C, 0xE5, 0x8F, 0x46, 0x73, 0x30, 0xBE, 0x10,
+    0x46, 0xD9, 0x9C, 0xBB, 0x76, 0xA6, 0xE0, 0x47,
+    0xF1, 0x59, 0xC5, 0x24, 0x66, 0xBB, 0x9A, 0x20,
+    0x55, 0x2F, 0xF3, 0x70, 0x05, 0x53, 0x7F, 0xB8,
+    0x45, 0xA8, 0xCE, 0x35, 0xE2, 0x9E, 0xC3, 0x25,
+    0xAE, 0xDB, 0x97, 0xB4, 0xD4, 0x75, 0x35, 0xB3,
+    0xDB, 0x6C, 0xC7, 0x1E, 0xA0, 0x32, 0xB9, 0x97,
+    0x4C, 0xA3, 0x08, 0xB9, 0x74, 0xF0, 0x67, 0xAF,
+    0x7A, 0x15, 0x68, 0xFA, 0xA6, 0xDC, 0x94, 0x62,
+    0xF8, 0x70, 0x05, 0xED, 0x3D, 0x27, 0x89, 0x1B,
+    0x7A, 0x9D, 0x3D, 0xD7, 0xA7, 0x01, 0x41, 0xF8,
+    0xCC, 0x82, 0xBE, 0x3A, 0xCF, 0xA7, 0x2C, 0xFA,
+    0x74, 0x27, 0x87, 0x12, 0xB2, 0x4F, 0x77, 0xFF,
+    0x43, 0x69, 0x05, 0x39, 0x5D, 0x21, 0xE7, 0x80,
+    0x58, 0x25, 0xAE, 0x81, 0x4F, 0xEC, 0x7A, 0x0D,
+    0xD8, 0x88, 0xFC, 0x37, 0x96, 0x4B, 0x20, 0xC9,
+    0x2E, 0xD5, 0xB5, 0x0B, 0x58, 0x20, 0x3B, 0xD0,
+    0xA3, 0x28, 0x8A, 0x53, 0xCC, 0x6A, 0xB8, 0xD2,
+    0x2F, 0xE3, 0x0E, 0x89, 0x52, 0xE1, 0x7B, 0x6A,
+    0xAB, 0x0A, 0x5E, 0x97, 0xE8, 0x1C, 0x62, 0xCA,
+    0x03, 0xE5, 0x59, 0xF7, 0x6A, 0x20, 0xD6, 0x0B,
+    0x89, 0xE5, 0xBF, 0xF2, 0x8F, 0xAA, 0xC8, 0x0D,
+    0x9E, 0x40, 0xF7, 0x06, 0xD9, 0x61, 0xC9, 0x3D,
+    0x6F, 0x25, 0x62, 0xB0, 0x11, 0xDA, 0x8C, 0xEB,
+    0x56, 0x84, 0x3D, 0x92, 0xC1, 0xEF, 0x85, 0x0A,
+    0x55, 0xC6, 0xB4, 0x14, 0x97, 0xFE, 0x02, 0x4F,
+    0x67, 0xBA, 0x75, 0xF9, 0x20, 0x94, 0xBE, 0x13,
+    0x4A, 0xE0, 0x24, 0x7C, 0x45, 0xBB, 0x8E, 0x4C,
+    0x96, 0xAD, 0x42, 0xC1, 0x93, 0x3A, 0xB7, 0x5F,
+    0xA3, 0x2D, 0x4F, 0x7F, 0x12, 0x44, 0x68, 0x30,
+    0xEA, 0xBE, 0x70, 0x95, 0x2B, 0xAD, 0x1B, 0xA5,
+    0xEE, 0xC4, 0x48, 0xE3, 0x6C, 0xA9, 0x3B, 0x03,
+    0x9F, 0xF6, 0x1E, 0xD9, 0x78, 0x49, 0xB1, 0x6E,
+    0xF4, 0x33, 0x79, 0xE4, 0x5D, 0x37, 0x85, 0xA7,
+    0xEF, 0x22, 0x42, 0xC8, 0x63, 0x39, 0xE9, 0x2C,
+    0x8B, 0xC7, 0x9F, 0xFD, 0x14, 0x6D, 0xF0, 0x34,
+    0xDB, 0x1D, 0x7A, 0x09, 0xDD, 0x80, 0xF4, 0x15,
+    0xCB, 0x74, 0x1E, 0xD5, 0xB8, 0xF9, 0x98, 0xD8,
+    0x88, 0x14, 0x5B, 0xD1, 0x48, 0x86, 0xE4, 0x4F,
+    0x93, 0x00, 0x83, 0x1F, 0xCB, 0x58, 0x7D, 0xBF,
+    0x6D, 0x4D, 0xAC, 0x65, 0x2F, 0x15, 0xE0, 0x9A,
+    0x1D, 0xD6, 0x48, 0xA4, 0x23, 0xBC, 0xDC, 0x14,
+    0x8E, 0x58, 0xB1, 0x9C, 0x15, 0xD4, 0xAD, 0x5A,
+    0xF3, 0x6F, 0x36, 0x57, 0xD5, 0xAA, 0x0C, 0x82,
+    0xB6, 0x69, 0xD2, 0x9E, 0x2C, 0x54, 0xA8, 0x44,
+    0x93, 0xF0, 0xAD, 0x65, 0x2F, 0x55, 0x09, 0x77,
+    0x4E, 0xA7, 0x35, 0xF2, 0xB5, 0x0A, 0x75, 0x2D,
+    0x5F, 0xBC, 0xF3, 0x9F, 0x2F, 0xFB, 0x14, 0xDD,
+    0x2A, 0xC5, 0x09, 0xE9, 0x9E, 0xC7, 0x5D, 0x39,
+    0xBD, 0x67, 0x08, 0x83, 0xF5, 0x71, 0x43, 0xC5,
+    0x7B, 0xD1, 0x0D, 0xEA, 0x85, 0x72, 0x43, 0x9A,
+    0x1B, 0xB3, 0x02, 0xC0, 0x87, 0x41, 0xE4, 0x26,
+    0x53, 0xFE, 0x36, 0x5E, 0xED, 0x1A, 0x6F, 0xD2,
+    0x33, 0x57, 0x01, 0x91, 0xE8, 0xA3, 0xD0, 0x27,
+    0xED, 0xC3, 0x7E, 0x1E, 0x63, 0xCA, 0xFE, 0xB0,
+    0xDD, 0x15, 0x3F, 0x77, 0x4E, 0x93, 0xB5, 0x47,
+    0x8A, 0xE3, 0x7A, 0x43, 0x86, 0xF6, 0x00, 0x7B,
+    0x8F, 0xEE, 0xAF, 0xCD, 0x12, 0x55, 0x9E, 0x2D,
+    0xFA, 0x36, 0x6E, 0x4E, 0x28, 0xFE, 0x0A, 0xCF,
+    0x82, 0x4E, 0xEB, 0x6A, 0x2C, 0x9A, 0x60, 0xC4,
+    0x94, 0x13, 0xAB, 0xC6, 0x8A, 0xB7, 0xE1, 0x0E,
+    0x87, 0xB6, 0xDC, 0x3C, 0x7D, 0x1A, 0x67, 0xB1,
+    0x41, 0x02, 0xDF, 0xA2, 0x43, 0x92, 0x1C, 0x3C,
+    0x87, 0x6C, 0xAA, 0xC3, 0x09, 0xE5, 0x69, 0x1C,
+    0xA5, 0x5C, 0x31, 0xB6, 0x1A, 0x52, 0xAB, 0xDC,
+    0x4A, 0x28, 0x5A, 0x3B, 0x90, 0xB5, 0xE4, 0x05,
+    0xAA, 0x92, 0xE0, 0xAE, 0xC2, 0x91, 0x5D, 0xB6,
+    0x26, 0xD9, 0xA4, 0x1D, 0xD1, 0xF8, 0x05, 0x73,
+    0xD9, 0x43, 0x81, 0x06, 0x4B, 0x28, 0x9C, 0x62,
+    0xFC, 0x26, 0x72, 0xC8, 0x4C, 0xBE, 0xFE, 0x8A,
+    0x59, 0x96, 0x68, 0x30, 0xD6, 0x72, 0x56, 0xA0,
+    0xD1, 0x29, 0xE9, 0x5B, 0xD0, 0x80, 0x2C, 0xF1,
+    0xD1, 0x0F, 0xFF, 0x92, 0xD4, 0x72, 0x31, 0xC3,
+    0x17, 0xA1, 0xDE, 0x6F, 0xF1, 0x20, 0x65, 0x4B,
+    0x76, 0x19, 0x5B, 0x02, 0x3F, 0xDA, 0x33, 0xED,
+    0x78, 0x3D, 0x8F, 0x54, 0x7C, 0xB5, 0x49, 0xA7,
+    0x2E, 0xEE, 0x60, 0xCF, 0xF8, 0x7B, 0x3A, 0xC2,
+    0x48, 0xA1, 0x15, 0xEB, 0x2A, 0x9B, 0x0B, 0x35,
+    0xC6, 0xF1, 0x15, 0xB8, 0xF6, 0x05, 0xC2, 0xED,
+    0x0E, 0x4B, 0x95, 0x1E, 0x3A, 0xA4, 0x55, 0x96,
+    0x70, 0x4A, 0xC1, 0x61, 0x27, 0xEE, 0x96, 0x63,
+    0xFB, 0x7D, 0x06, 0xC0, 0x32, 0x82, 0xD6, 0xC2,
+    0x27, 0xF5, 0xCE, 0x9C, 0x6A, 0x7F, 0x11, 0x9F,
+    0x67, 0x08, 0xF5, 0xC8, 0x12, 0x36, 0xE4, 0x87,
+    0x17, 0xB6, 0x9A, 0x21, 0x6B, 0xA9, 0xE6, 0x08,
+    0x80, 0xD0, 0x68, 0xAC, 0x83, 0x5B, 0xD5, 0x78,
+    0x20, 0xA8, 0x7C, 0x4D, 0x87, 0xA7, 0x2E, 0x7E,
+    0x68, 0xBB, 0xF8, 0x85, 0xDF, 0xBC, 0x01, 0xC9,
+    0x38, 0xAF, 0x83, 0x06, 0xA6, 0x49, 0x0E, 0xB5,
+    0x3F, 0xCE, 0x94, 0x4D, 0xA9, 0x0F, 0x97, 0x3C,
+    0xB1, 0x85, 0x47, 0xB9, 0x20, 0xF6, 0xCB, 0x48,
+    0xE2, 0xB9, 0x28, 0xAA, 0x6B, 0x98, 0x5C, 0xCC,
+    0x6E, 0x4C, 0xE6, 0x38, 0xBB, 0x15, 0x5A, 0x95,
+    0xF4, 0x33, 0x51, 0x04, 0xF6, 0x3E, 0xB2, 0xEB,
+    0x50, 0xCE, 0x39, 0xE6, 0x21, 0x64, 0x46, 0xDB,
+    0x9B, 0x37, 0x5F, 0x13, 0x6E, 0x47, 0xFB, 0x7B,
+    0x15, 0xEA, 0x2C, 0xDE, 0xC6, 0x8B, 0xE4, 0x77,
+    0x2B, 0x5D, 0x1B, 0xE4, 0x6A, 0xFE, 0x55, 0xDF,
+    0x07, 0x65, 0x31, 0xE8, 0x8D, 0x54, 0xA8, 0x1D,
+    0x95, 0x56, 0x7E, 0x44, 0xD7, 0xFD, 0x09, 0x28,
+    0xF1, 0x91, 0x00, 0x7D, 0xDE, 0x44, 0xC6, 0x71,
+    0x1F, 0xB5, 0xD9, 0x8D, 0xC0, 0x22, 0x66, 0x11,
+    0x93, 0x6C, 0x07, 0x99, 0xD1, 0xB6, 0xF9, 0x1C,
+    0xC5, 0x07, 0xB0, 0xD8, 0x9D, 0x1C, 0xAC, 0x60,
+    0xD3, 0x90, 0x52, 0x75, 0x37, 0x67, 0x20, 0xD2,
+    0xAE, 0xF3, 0x80, 0xC6, 0x41, 0xBA, 0x21, 0x72,
+    0xEC, 0xA2, 0xD5, 0x0F, 0x71, 0x38, 0xC1, 0x7B,
+    0x34, 0xCD, 0xEF, 0x16, 0x8B, 0x31, 0xA8, 0xC3,
+    0x3E, 0xB1, 0xD6, 0x5E, 0x8D, 0xA1, 0x2F, 0xD4,
+    0x4A, 0x9E, 0x6F, 0x1C, 0xE2, 0x79, 0x9F, 0xDB,
+    0x3F, 0xFB, 0xC0, 0x58, 0x75, 0x0C, 0x90, 0x55,
+    0x76, 0xEC, 0x88, 0x52, 0x31, 0xEB, 0x8A, 0x25,
+    0x3F, 0xA4, 0xF2, 0x1B, 0xAA, 0xFA, 0x55, 0x93,
+    0x0B, 0x49, 0xA6, 0x2E, 0x01, 0x9E, 0x89, 0xC8
+};
+
+#endif
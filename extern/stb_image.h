@@ -301,6 +301,14 @@ RECENT REVISION HISTORY:
 //   - If you use STBI_NO_PNG (or _ONLY_ without PNG), and you still
 //     want the zlib decoder to be available, #define STBI_SUPPORT_ZLIB
 //
+//   - If you #define STBI_THREADS, the restart intervals of baseline JPEGs
+//     loaded from memory are decoded by a pool of threads, and
+//     stbi_load_rows* inflate large non-interlaced PNGs on a second thread,
+//     while the calling thread unfilters and converts the rows and passes
+//     them on. That thread calls the stbi_io_callbacks, if any. The number
+//     of threads is set with stbi_set_threads_on_load. Uses Win32 threads on
+//     Windows and pthreads everywhere else.
+//
 
 
 #ifndef STBI_NO_STDIO
@@ -366,6 +374,64 @@ STBIDEF stbi_uc *stbi_load_from_file  (FILE *f, int *x, int *y, int *channels_in
 // for stbi_load_from_file, file pointer is left pointing immediately after image
 #endif
 
+////////////////////////////////////
+//
+// row-by-row interface
+//
+
+typedef struct
+{
+   int      (*size)  (void *user,int x,int y,int channels_in_file);  // called once with the size of the rows to come. return 0 to stop
+   int      (*rows)  (void *user,stbi_uc *data,int y,int count);     // rows y to y+count-1, tightly packed. return 0 to stop
+} stbi_row_callbacks;
+
+// these pass the image on a few rows at a time, in order, as they are decoded,
+// so that it never has to be in memory as a whole. that works for
+// non-interlaced PNGs and baseline JPEGs; anything else is loaded whole and
+// passed on in one go. the data is only valid during the callback. returns 0
+// on failure, which may come after some of the rows. with desired_channels 0,
+// the rows have channels_in_file components, which for PNGs includes the
+// alpha a tRNS chunk adds
+STBIDEF int stbi_load_rows_from_memory   (stbi_uc           const *buffer, int len   , stbi_row_callbacks const *rows, void *rows_user, int desired_channels);
+STBIDEF int stbi_load_rows_from_callbacks(stbi_io_callbacks const *clbk  , void *user, stbi_row_callbacks const *rows, void *rows_user, int desired_channels);
+
+#ifndef STBI_NO_STDIO
+STBIDEF int stbi_load_rows            (char const *filename, stbi_row_callbacks const *rows, void *rows_user, int desired_channels);
+STBIDEF int stbi_load_rows_from_file  (FILE *f, stbi_row_callbacks const *rows, void *rows_user, int desired_channels);
+#endif
+
+// like stbi_info, for images that stbi_load_rows* has to load whole as far
+// as their header tells: interlaced PNGs, progressive JPEGs and every other
+// format. returns 1 and the size their pixels are decoded at, which for PNGs
+// and JPEGs is after stbi_set_min_size_on_load, or 0 for the rest and for
+// unreadable ones
+STBIDEF int stbi_info_whole_from_memory   (stbi_uc const *buffer, int len, int *x, int *y, int *comp);
+STBIDEF int stbi_info_whole_from_callbacks(stbi_io_callbacks const *clbk, void *user, int *x, int *y, int *comp);
+
+#ifndef STBI_NO_STDIO
+STBIDEF int stbi_info_whole           (char const *filename, int *x, int *y, int *comp);
+STBIDEF int stbi_info_whole_from_file (FILE *f, int *x, int *y, int *comp);
+#endif
+
+////////////////////////////////////
+//
+// uncompressed pixels
+//
+
+typedef struct
+{
+   int x, y;
+   stbi_uc const *data; // the top row
+   int stride;          // bytes from one row to the next, negative if stored bottom-up
+   int channels;        // 1 grey, 2 grey+alpha, 3 rgb, 4 rgba
+   int bgr;             // red and blue are swapped
+} stbi_raw_layout;
+
+// 8-bit BMP, PNM and TGA files without a palette or RLE keep their pixels as
+// they are. this finds them in the buffer, so they can be used without being
+// loaded at all. returns 0 for anything else, which has to be loaded normally
+STBIDEF int stbi_raw_layout_from_memory(stbi_uc const *buffer, int len, stbi_raw_layout *layout);
+
 ////////////////////////////////////
 //
 // 16-bits-per-channel interface
@@ -446,6 +512,36 @@ STBIDEF void stbi_convert_iphone_png_to_rgb(int flag_true_if_should_convert);
 // flip the image vertically, so the first pixel in the output array is the bottom left
 STBIDEF void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip);
 
+// allow loaders to return a smaller image than stored in the file, as long as
+// it is at least min_x by min_y pixels. JPEGs are then decoded at 1/2, 1/4 or
+// 1/8 scale, and interlaced PNGs stop after the Adam7 passes that cover the
+// size, which is much faster. note that the aspect ratio of a partial PNG can
+// be off by 2x. 0 by 0 (the default) always loads the full image.
+STBIDEF void stbi_set_min_size_on_load(int min_x, int min_y);
+
+#ifdef STBI_THREADS
+// the most threads a loader may use at once, counting the one that calls it.
+// 0 (the default) is one per CPU core, 1 never starts any. with more than
+// one, baseline JPEGs with restart markers are decoded in parallel and large
+// PNGs are inflated on a thread of their own, see STBI_THREADS
+STBIDEF void stbi_set_threads_on_load(int threads);
+#endif
+
+// as above, but only applies to images loaded on the thread that calls these;
+// once set, they override the global flags on that thread. together with the
+// per-thread stbi_failure_reason(), this lets several threads load images at
+// once with different settings. not available if STBI_NO_THREAD_LOCALS is
+// defined or the compiler has no thread-local storage.
+#ifndef STBI_NO_THREAD_LOCALS
+STBIDEF void stbi_set_unpremultiply_on_load_thread(int flag_true_if_should_unpremultiply);
+STBIDEF void stbi_convert_iphone_png_to_rgb_thread(int flag_true_if_should_convert);
+STBIDEF void stbi_set_flip_vertically_on_load_thread(int flag_true_if_should_flip);
+STBIDEF void stbi_set_min_size_on_load_thread(int min_x, int min_y);
+#ifdef STBI_THREADS
+STBIDEF void stbi_set_threads_on_load_thread(int threads);
+#endif
+#endif
+
 // ZLIB client - used by PNG, available for other purposes
 
 STBIDEF char *stbi_zlib_decode_malloc_guesssize(const char *buffer, int len, int initial_size, int *outlen);
@@ -537,17 +633,37 @@ STBIDEF int   stbi_zlib_decode_noheader_buffer(char *obuffer, int olen, const ch
 #endif
 
 
+#ifndef STBI_NO_THREAD_LOCALS
+   #if defined(__cplusplus) &&  __cplusplus >= 201103L
+      #define STBI_THREAD_LOCAL       thread_local
+   #elif defined(__GNUC__) && __GNUC__ < 5
+      #define STBI_THREAD_LOCAL       __thread
+   #elif defined(_MSC_VER)
+      #define STBI_THREAD_LOCAL       __declspec(thread)
+   #elif defined (__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+      #define STBI_THREAD_LOCAL       _Thread_local
+   #endif
+
+   #ifndef STBI_THREAD_LOCAL
+      #if defined(__GNUC__)
+         #define STBI_THREAD_LOCAL    __thread
+      #endif
+   #endif
+#endif
+
 #ifdef _MSC_VER
 typedef unsigned short stbi__uint16;
 typedef   signed short stbi__int16;
 typedef unsigned int   stbi__uint32;
 typedef   signed int   stbi__int32;
+typedef unsigned __int64 stbi__uint64;
 #else
 #include <stdint.h>
 typedef uint16_t stbi__uint16;
 typedef int16_t  stbi__int16;
 typedef uint32_t stbi__uint32;
 typedef int32_t  stbi__int32;
+typedef uint64_t stbi__uint64;
 #endif
 
 // should produce compiler error if size is wrong
@@ -587,6 +703,45 @@ typedef unsigned char validate_uint32[sizeof(stbi__uint32)==4 ? 1 : -1];
 #define STBI_REALLOC_SIZED(p,oldsz,newsz) STBI_REALLOC(p,newsz)
 #endif
 
+#ifdef STBI_THREADS
+#ifdef _WIN32
+#include <windows.h>
+typedef HANDLE             stbi__thread;
+typedef CRITICAL_SECTION   stbi__mutex;
+typedef CONDITION_VARIABLE stbi__cond;
+#define STBI__THREAD_PROC(name, arg)   static DWORD WINAPI name(LPVOID arg)
+#define STBI__THREAD_RETURN            return 0
+#define stbi__thread_create(t, f, arg) ((*(t) = CreateThread(NULL, 0, f, arg, 0, NULL)) != NULL)
+#define stbi__thread_join(t)           (WaitForSingleObject(t, INFINITE), CloseHandle(t))
+#define stbi__mutex_init(m)            (InitializeCriticalSection(m), 1)
+#define stbi__mutex_destroy(m)         DeleteCriticalSection(m)
+#define stbi__mutex_lock(m)            EnterCriticalSection(m)
+#define stbi__mutex_unlock(m)          LeaveCriticalSection(m)
+#define stbi__cond_init(c)             (InitializeConditionVariable(c), 1)
+#define stbi__cond_destroy(c)          ((void) 0)
+#define stbi__cond_wait(c, m)          SleepConditionVariableCS(c, m, INFINITE)
+#define stbi__cond_broadcast(c)        WakeAllConditionVariable(c)
+#else
+#include <pthread.h>
+#include <unistd.h> // sysconf
+typedef pthread_t       stbi__thread;
+typedef pthread_mutex_t stbi__mutex;
+typedef pthread_cond_t  stbi__cond;
+#define STBI__THREAD_PROC(name, arg)   static void *name(void *arg)
+#define STBI__THREAD_RETURN            return NULL
+#define stbi__thread_create(t, f, arg) (pthread_create(t, NULL, f, arg) == 0)
+#define stbi__thread_join(t)           pthread_join(t, NULL)
+#define stbi__mutex_init(m)            (pthread_mutex_init(m, NULL) == 0)
+#define stbi__mutex_destroy(m)         pthread_mutex_destroy(m)
+#define stbi__mutex_lock(m)            pthread_mutex_lock(m)
+#define stbi__mutex_unlock(m)          pthread_mutex_unlock(m)
+#define stbi__cond_init(c)             (pthread_cond_init(c, NULL) == 0)
+#define stbi__cond_destroy(c)          pthread_cond_destroy(c)
+#define stbi__cond_wait(c, m)          pthread_cond_wait(c, m)
+#define stbi__cond_broadcast(c)        pthread_cond_broadcast(c)
+#endif
+#endif
+
 // x86/x64 detection
 #if defined(__x86_64__) || defined(_M_X64)
 #define STBI__X64_TARGET
@@ -665,6 +820,37 @@ static int stbi__sse2_available(void)
    return 1;
 }
 #endif
+
+// AVX2 kernels are compiled for AVX2 through a function attribute, and only
+// picked at runtime if the CPU has it, so the library still runs anywhere
+// SSE2 does. define STBI_NO_AVX2 to leave them out.
+#if !defined(STBI_NO_AVX2) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5) || (defined(_MSC_VER) && _MSC_VER >= 1700))
+#define STBI_AVX2
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define STBI__AVX2_TARGET __attribute__((target("avx2")))
+
+static int stbi__avx2_available(void)
+{
+   return __builtin_cpu_supports("avx2");
+}
+#else
+#define STBI__AVX2_TARGET
+
+static int stbi__avx2_available(void)
+{
+   int info[4];
+   __cpuid(info, 0);
+   if (info[0] < 7) return 0;
+   // the OS has to save the YMM registers on context switches, too
+   __cpuid(info, 1);
+   if ((info[2] & 0x18000000) != 0x18000000 || (_xgetbv(0) & 6) != 6) return 0;
+   __cpuidex(info, 7, 0);
+   return (info[1] >> 5) & 1;
+}
+#endif
+#endif // !STBI_NO_AVX2
 #endif
 
 // ARM NEON
@@ -783,15 +969,25 @@ typedef struct
    int channel_order;
 } stbi__result_info;
 
+typedef struct
+{
+   stbi_row_callbacks const *c;
+   void *user;
+   int req_comp;
+   int done; // the loader has passed every row on as it decoded them
+} stbi__rows;
+
 #ifndef STBI_NO_JPEG
 static int      stbi__jpeg_test(stbi__context *s);
 static void    *stbi__jpeg_load(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi__result_info *ri);
+static int      stbi__jpeg_load_rows(stbi__context *s, stbi__rows *rows);
 static int      stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp);
 #endif
 
 #ifndef STBI_NO_PNG
 static int      stbi__png_test(stbi__context *s);
 static void    *stbi__png_load(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi__result_info *ri);
+static int      stbi__png_load_rows(stbi__context *s, stbi__rows *rows);
 static int      stbi__png_info(stbi__context *s, int *x, int *y, int *comp);
 static int      stbi__png_is16(stbi__context *s);
 #endif
@@ -840,8 +1036,13 @@ static void    *stbi__pnm_load(stbi__context *s, int *x, int *y, int *comp, int
 static int      stbi__pnm_info(stbi__context *s, int *x, int *y, int *comp);
 #endif
 
-// this is not threadsafe
-static const char *stbi__g_failure_reason;
+// only threadsafe if STBI_THREAD_LOCAL is available
+#ifdef STBI_THREAD_LOCAL
+static STBI_THREAD_LOCAL
+#else
+static
+#endif
+const char *stbi__g_failure_reason;
 
 STBIDEF const char *stbi_failure_reason(void)
 {
@@ -962,13 +1163,93 @@ static float   *stbi__ldr_to_hdr(stbi_uc *data, int x, int y, int comp);
 static stbi_uc *stbi__hdr_to_ldr(float   *data, int x, int y, int comp);
 #endif
 
-static int stbi__vertically_flip_on_load = 0;
+static int stbi__vertically_flip_on_load_global = 0;
 
 STBIDEF void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip)
 {
-    stbi__vertically_flip_on_load = flag_true_if_should_flip;
+   stbi__vertically_flip_on_load_global = flag_true_if_should_flip;
+}
+
+#ifndef STBI_THREAD_LOCAL
+#define stbi__vertically_flip_on_load  stbi__vertically_flip_on_load_global
+#else
+static STBI_THREAD_LOCAL int stbi__vertically_flip_on_load_local, stbi__vertically_flip_on_load_set;
+
+STBIDEF void stbi_set_flip_vertically_on_load_thread(int flag_true_if_should_flip)
+{
+   stbi__vertically_flip_on_load_local = flag_true_if_should_flip;
+   stbi__vertically_flip_on_load_set = 1;
+}
+
+#define stbi__vertically_flip_on_load  (stbi__vertically_flip_on_load_set       \
+                                         ? stbi__vertically_flip_on_load_local  \
+                                         : stbi__vertically_flip_on_load_global)
+#endif // STBI_THREAD_LOCAL
+
+static int stbi__min_load_x_global = 0;
+static int stbi__min_load_y_global = 0;
+
+STBIDEF void stbi_set_min_size_on_load(int min_x, int min_y)
+{
+   stbi__min_load_x_global = min_x;
+   stbi__min_load_y_global = min_y;
+}
+
+#ifndef STBI_THREAD_LOCAL
+#define stbi__min_load_x  stbi__min_load_x_global
+#define stbi__min_load_y  stbi__min_load_y_global
+#else
+static STBI_THREAD_LOCAL int stbi__min_load_x_local, stbi__min_load_y_local, stbi__min_load_set;
+
+STBIDEF void stbi_set_min_size_on_load_thread(int min_x, int min_y)
+{
+   stbi__min_load_x_local = min_x;
+   stbi__min_load_y_local = min_y;
+   stbi__min_load_set = 1;
+}
+
+#define stbi__min_load_x  (stbi__min_load_set ? stbi__min_load_x_local : stbi__min_load_x_global)
+#define stbi__min_load_y  (stbi__min_load_set ? stbi__min_load_y_local : stbi__min_load_y_global)
+#endif // STBI_THREAD_LOCAL
+
+#ifdef STBI_THREADS
+static int stbi__threads_on_load_global = 0;
+
+STBIDEF void stbi_set_threads_on_load(int threads)
+{
+   stbi__threads_on_load_global = threads;
+}
+
+#ifndef STBI_THREAD_LOCAL
+#define stbi__threads_on_load  stbi__threads_on_load_global
+#else
+static STBI_THREAD_LOCAL int stbi__threads_on_load_local, stbi__threads_on_load_set;
+
+STBIDEF void stbi_set_threads_on_load_thread(int threads)
+{
+   stbi__threads_on_load_local = threads;
+   stbi__threads_on_load_set = 1;
 }
 
+#define stbi__threads_on_load  (stbi__threads_on_load_set ? stbi__threads_on_load_local : stbi__threads_on_load_global)
+#endif // STBI_THREAD_LOCAL
+
+static int stbi__load_threads(void)
+{
+   int n = stbi__threads_on_load;
+   if (n <= 0) {
+      #ifdef _WIN32
+      SYSTEM_INFO info;
+      GetSystemInfo(&info);
+      n = (int) info.dwNumberOfProcessors;
+      #else
+      n = (int) sysconf(_SC_NPROCESSORS_ONLN);
+      #endif
+   }
+   return n < 1 ? 1 : n;
+}
+#endif // STBI_THREADS
+
 static void *stbi__load_main(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi__result_info *ri, int bpc)
 {
    memset(ri, 0, sizeof(*ri)); // make sure it's initialized if we add new fields
@@ -1233,6 +1514,78 @@ STBIDEF stbi_uc *stbi_load_from_callbacks(stbi_io_callbacks const *clbk, void *u
    return stbi__load_and_postprocess_8bit(&s,x,y,comp,req_comp);
 }
 
+// passes a whole image on, for the loaders that can't go row by row
+static int stbi__rows_whole(stbi__rows *r, stbi_uc *data, int x, int y, int comp)
+{
+   int ok;
+   if (data == NULL) return 0;
+   ok = r->c->size(r->user, x, y, comp) && r->c->rows(r->user, data, 0, y);
+   STBI_FREE(data);
+   if (!ok) return stbi__err("stopped", "Stopped by the row callback");
+   return 1;
+}
+
+static int stbi__load_rows(stbi__context *s, stbi_row_callbacks const *c, void *user, int req_comp)
+{
+   stbi__rows r;
+   stbi_uc *data;
+   int x = 0, y = 0, comp = 0;
+   if (req_comp < 0 || req_comp > 4) return stbi__err("bad req_comp", "Internal error");
+   r.c = c;
+   r.user = user;
+   r.req_comp = req_comp;
+   r.done = 0;
+   if (!stbi__vertically_flip_on_load) {
+      #ifndef STBI_NO_PNG
+      if (stbi__png_test(s)) return stbi__png_load_rows(s, &r);
+      #endif
+      #ifndef STBI_NO_JPEG
+      if (stbi__jpeg_test(s)) return stbi__jpeg_load_rows(s, &r);
+      #endif
+   }
+   data = stbi__load_and_postprocess_8bit(s, &x, &y, &comp, req_comp);
+   return stbi__rows_whole(&r, data, x, y, comp);
+}
+
+STBIDEF int stbi_load_rows_from_memory(stbi_uc const *buffer, int len, stbi_row_callbacks const *rows, void *rows_user, int req_comp)
+{
+   stbi__context s;
+   stbi__start_mem(&s,buffer,len);
+   return stbi__load_rows(&s,rows,rows_user,req_comp);
+}
+
+STBIDEF int stbi_load_rows_from_callbacks(stbi_io_callbacks const *clbk, void *user, stbi_row_callbacks const *rows, void *rows_user, int req_comp)
+{
+   stbi__context s;
+   stbi__start_callbacks(&s, (stbi_io_callbacks *) clbk, user);
+   return stbi__load_rows(&s,rows,rows_user,req_comp);
+}
+
+#ifndef STBI_NO_STDIO
+STBIDEF int stbi_load_rows(char const *filename, stbi_row_callbacks const *rows, void *rows_user, int req_comp)
+{
+   FILE *f = stbi__fopen(filename, "rb");
+   int result;
+   if (!f) return stbi__err("can't fopen", "Unable to open file");
+   result = stbi_load_rows_from_file(f,rows,rows_user,req_comp);
+   fclose(f);
+   return result;
+}
+
+STBIDEF int stbi_load_rows_from_file(FILE *f, stbi_row_callbacks const *rows, void *rows_user, int req_comp)
+{
+   int result;
+   stbi__context s;
+   stbi__start_file(&s,f);
+   result = stbi__load_rows(&s,rows,rows_user,req_comp);
+   if (result) {
+      // need to 'unget' all the characters in the IO buffer
+      fseek(f, - (int) (s.img_buffer_end - s.img_buffer), SEEK_CUR);
+   }
+   return result;
+}
+#endif //!STBI_NO_STDIO
+
 #ifndef STBI_NO_GIF
 STBIDEF stbi_uc *stbi_load_gif_from_memory(stbi_uc const *buffer, int len, int **delays, int *x, int *y, int *z, int *comp, int req_comp)
 {
@@ -1725,6 +2078,8 @@ typedef struct
       stbi_uc *linebuf;
       short   *coeff;   // progressive only
       int      coeff_w, coeff_h; // number of 8x8 coefficient blocks
+      int      dc_done; // dc_only: seen a scan that completes the DC
+      int      y0;      // window: the first row held in data
    } img_comp[4];
 
    stbi__uint32   code_buffer; // jpeg entropy-coded buffer
@@ -1745,12 +2100,32 @@ typedef struct
    int scan_n, order[4];
    int restart_interval, todo;
 
+   // log2 of the downscale done by the IDCT, blocks decode to (8>>scale_shift)^2
+   int scale_shift;
+   // progressive at 1/8 scale: only DC coefficients are kept, one per block,
+   // AC scans are skipped and decoding stops once the DC is complete
+   int dc_only;
+
+   // row-by-row loading: a baseline image with all components in one scan
+   // is decoded into a window of a couple of MCU rows, which are converted
+   // and passed on as soon as they're complete
+   stbi__rows *rows;
+   int window;
+   struct stbi__jpeg_stream *stream; // set once the scan starts
+   // restart intervals the thread pool decodes at a time into the window,
+   // which is made to hold them. 0 if it doesn't. the last MCU row of a band
+   // can be partly decoded, which filled counts as well
+   int band, filled;
+
 // kernels
    void (*idct_block_kernel)(stbi_uc *out, int out_stride, short data[64]);
    void (*YCbCr_to_RGB_kernel)(stbi_uc *out, const stbi_uc *y, const stbi_uc *pcb, const stbi_uc *pcr, int count, int step);
    stbi_uc *(*resample_row_hv_2_kernel)(stbi_uc *out, stbi_uc *in_near, stbi_uc *in_far, int w, int hs);
 } stbi__jpeg;
 
+static int stbi__jpeg_stream_start(stbi__jpeg *z);
+static int stbi__jpeg_stream_rows(stbi__jpeg *z, int units);
+
 static int stbi__build_huffman(stbi__huffman *h, int *count)
 {
    int i,j,k=0;
@@ -2013,7 +2388,8 @@ static int stbi__jpeg_decode_block_prog_dc(stbi__jpeg *j, short data[64], stbi__
 
    if (j->succ_high == 0) {
       // first scan for DC coefficient, must be first
-      memset(data,0,64*sizeof(data[0])); // 0 all the ac values now
+      if (!j->dc_only)
+         memset(data,0,64*sizeof(data[0])); // 0 all the ac values now
       t = stbi__jpeg_huff_decode(j, hdc);
       diff = t ? stbi__extend_receive(j, t) : 0;
 
@@ -2260,6 +2636,62 @@ static void stbi__idct_block(stbi_uc *out, int out_stride, short data[64])
    }
 }
 
+// reduced IDCTs for decoding at 1/2, 1/4 and 1/8 scale. an N-point IDCT of the
+// lowest NxN coefficients gives the block downscaled to NxN pixels, the same
+// way as in libjpeg. the constants are 1/2 * c(u) * cos((2k+1)*u*pi/(2N)),
+// scaled up by 1<<12 like in stbi__idct_block
+static void stbi__idct_reduced(stbi_uc *out, int out_stride, short data[64], int n, const int *c)
+{
+   int i,j,k,val[16];
+
+   // columns, keeping 2 extra bits of precision
+   for (i=0; i < n; ++i) {
+      for (k=0; k < n; ++k) {
+         int x = 512;
+         for (j=0; j < n; ++j)
+            x += c[k*n+j] * data[j*8+i];
+         val[k*n+i] = x >> 10;
+      }
+   }
+
+   // rows, removing the remaining 1<<14 with rounding and adding 128
+   for (k=0; k < n; ++k, out += out_stride) {
+      for (i=0; i < n; ++i) {
+         int x = (1 << 13) + (128 << 14);
+         for (j=0; j < n; ++j)
+            x += c[i*n+j] * val[k*n+j];
+         out[i] = stbi__clamp(x >> 14);
+      }
+   }
+}
+
+static void stbi__idct_block_4x4(stbi_uc *out, int out_stride, short data[64])
+{
+   static const int c[16] = {
+      stbi__f2f(0.353553391f), stbi__f2f( 0.461939766f), stbi__f2f( 0.353553391f), stbi__f2f( 0.191341716f),
+      stbi__f2f(0.353553391f), stbi__f2f( 0.191341716f), stbi__f2f(-0.353553391f), stbi__f2f(-0.461939766f),
+      stbi__f2f(0.353553391f), stbi__f2f(-0.191341716f), stbi__f2f(-0.353553391f), stbi__f2f( 0.461939766f),
+      stbi__f2f(0.353553391f), stbi__f2f(-0.461939766f), stbi__f2f( 0.353553391f), stbi__f2f(-0.191341716f)
+   };
+   stbi__idct_reduced(out, out_stride, data, 4, c);
+}
+
+static void stbi__idct_block_2x2(stbi_uc *out, int out_stride, short data[64])
+{
+   static const int c[4] = {
+      stbi__f2f(0.353553391f), stbi__f2f( 0.353553391f),
+      stbi__f2f(0.353553391f), stbi__f2f(-0.353553391f)
+   };
+   stbi__idct_reduced(out, out_stride, data, 2, c);
+}
+
+static void stbi__idct_block_1x1(stbi_uc *out, int out_stride, short data[64])
+{
+   STBI_NOTUSED(out_stride);
+   // the DC coefficient is 8 times the mean of the block
+   out[0] = stbi__clamp(((data[0] + 4) >> 3) + 128);
+}
+
 #ifdef STBI_SSE2
 // sse2 integer IDCT. not the fastest possible implementation but it
 // produces bit-identical results to the generic C version so it's
@@ -2441,6 +2873,154 @@ static void stbi__idct_simd(stbi_uc *out, int out_stride, short data[64])
 
 #endif // STBI_SSE2
 
+#ifdef STBI_AVX2
+// avx2 integer IDCT, bit-identical to the sse2 one. each register holds two
+// rows a and b as a0-3 b0-3 | a4-7 b4-7, so unpacklo/unpackhi pick out a or b
+// with columns 0-3 in the low lane and 4-7 in the high one. the 32-bit
+// intermediates of a row then fit in one register, and the transposes need
+// half the shuffles.
+static STBI__AVX2_TARGET void stbi__idct_avx2(stbi_uc *out, int out_stride, short data[64])
+{
+   __m256i r01, r23, r45, r67; // pass input, rows (0|1), (2|3), (4|5), (6|7)
+   __m256i r07, r16, r25, r34; // pass output, rows (i | 7-i)
+
+   // dot product constant: even elems=x, odd elems=y
+   #define dct_const(x,y)  _mm256_set1_epi32((int) (((unsigned) (y) << 16) | ((x) & 0xffff)))
+
+   // out(0) = c0[even]*x + c0[odd]*y   (c0, x, y 16-bit, out 32-bit)
+   // out(1) = c1[even]*x + c1[odd]*y
+   // where x and y are the first (lo) or second (hi) rows of two registers
+   #define dct_rot(out0,out1, x,y,half,c0,c1) \
+      __m256i c0##xy = _mm256_unpack##half##_epi16((x),(y)); \
+      __m256i out0 = _mm256_madd_epi16(c0##xy, c0); \
+      __m256i out1 = _mm256_madd_epi16(c0##xy, c1)
+
+   // out = first row of in << 12  (in 16-bit, out 32-bit)
+   #define dct_widen(out, in) \
+      __m256i out = _mm256_srai_epi32(_mm256_unpacklo_epi16(_mm256_setzero_si256(), (in)), 4)
+
+   // butterfly a/b, add bias, then shift by "s" and pack as rows (a+b | a-b)
+   #define dct_bfly32o(out, a,b,bias,s) \
+      { \
+         __m256i abiased = _mm256_add_epi32(a, bias); \
+         __m256i sum = _mm256_srai_epi32(_mm256_add_epi32(abiased, b), s); \
+         __m256i dif = _mm256_srai_epi32(_mm256_sub_epi32(abiased, b), s); \
+         out = _mm256_packs_epi32(sum, dif); \
+      }
+
+   #define dct_pass(bias,shift) \
+      { \
+         /* even part */ \
+         dct_rot(t2e,t3e, r23,r67,lo, rot0_0,rot0_1); \
+         __m256i sum04 = _mm256_add_epi16(r01, r45); \
+         __m256i dif04 = _mm256_sub_epi16(r01, r45); \
+         dct_widen(t0e, sum04); \
+         dct_widen(t1e, dif04); \
+         __m256i x0 = _mm256_add_epi32(t0e, t3e); \
+         __m256i x3 = _mm256_sub_epi32(t0e, t3e); \
+         __m256i x1 = _mm256_add_epi32(t1e, t2e); \
+         __m256i x2 = _mm256_sub_epi32(t1e, t2e); \
+         /* odd part */ \
+         dct_rot(y0o,y2o, r67,r23,hi, rot2_0,rot2_1); \
+         dct_rot(y1o,y3o, r45,r01,hi, rot3_0,rot3_1); \
+         __m256i sum17 = _mm256_add_epi16(r01, r67); \
+         __m256i sum35 = _mm256_add_epi16(r23, r45); \
+         dct_rot(y4o,y5o, sum17,sum35,hi, rot1_0,rot1_1); \
+         __m256i x4 = _mm256_add_epi32(y0o, y4o); \
+         __m256i x5 = _mm256_add_epi32(y1o, y5o); \
+         __m256i x6 = _mm256_add_epi32(y2o, y5o); \
+         __m256i x7 = _mm256_add_epi32(y3o, y4o); \
+         dct_bfly32o(r07, x0,x7,bias,shift); \
+         dct_bfly32o(r16, x1,x6,bias,shift); \
+         dct_bfly32o(r25, x2,x5,bias,shift); \
+         dct_bfly32o(r34, x3,x4,bias,shift); \
+      }
+
+   __m256i rot0_0 = dct_const(stbi__f2f(0.5411961f), stbi__f2f(0.5411961f) + stbi__f2f(-1.847759065f));
+   __m256i rot0_1 = dct_const(stbi__f2f(0.5411961f) + stbi__f2f( 0.765366865f), stbi__f2f(0.5411961f));
+   __m256i rot1_0 = dct_const(stbi__f2f(1.175875602f) + stbi__f2f(-0.899976223f), stbi__f2f(1.175875602f));
+   __m256i rot1_1 = dct_const(stbi__f2f(1.175875602f), stbi__f2f(1.175875602f) + stbi__f2f(-2.562915447f));
+   __m256i rot2_0 = dct_const(stbi__f2f(-1.961570560f) + stbi__f2f( 0.298631336f), stbi__f2f(-1.961570560f));
+   __m256i rot2_1 = dct_const(stbi__f2f(-1.961570560f), stbi__f2f(-1.961570560f) + stbi__f2f( 3.072711026f));
+   __m256i rot3_0 = dct_const(stbi__f2f(-0.390180644f) + stbi__f2f( 2.053119869f), stbi__f2f(-0.390180644f));
+   __m256i rot3_1 = dct_const(stbi__f2f(-0.390180644f), stbi__f2f(-0.390180644f) + stbi__f2f( 1.501321110f));
+
+   // rounding biases in column/row passes, see stbi__idct_block for explanation.
+   __m256i bias_0 = _mm256_set1_epi32(512);
+   __m256i bias_1 = _mm256_set1_epi32(65536 + (128<<17));
+
+   // load two rows at a time, and swap the middle quarters into place
+   r01 = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i *) (data + 0*8)), 0xd8);
+   r23 = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i *) (data + 2*8)), 0xd8);
+   r45 = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i *) (data + 4*8)), 0xd8);
+   r67 = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i *) (data + 6*8)), 0xd8);
+
+   // column pass
+   dct_pass(bias_0, 10);
+
+   {
+      // 16bit 8x8 transpose, as two 4x4 transposes per lane: rows 0-3 and
+      // rows 4-7 of four columns each
+      __m256i a = _mm256_unpacklo_epi16(r07, r16); // rows 0,1
+      __m256i b = _mm256_unpacklo_epi16(r25, r34); // rows 2,3
+      __m256i c = _mm256_unpackhi_epi16(r34, r25); // rows 4,5
+      __m256i d = _mm256_unpackhi_epi16(r16, r07); // rows 6,7
+      __m256i c01 = _mm256_unpacklo_epi32(a, b);   // rows 0-3 of columns 0,1 | 4,5
+      __m256i c23 = _mm256_unpackhi_epi32(a, b);   // rows 0-3 of columns 2,3 | 6,7
+      __m256i c45 = _mm256_unpacklo_epi32(c, d);   // rows 4-7 of columns 0,1 | 4,5
+      __m256i c67 = _mm256_unpackhi_epi32(c, d);   // rows 4-7 of columns 2,3 | 6,7
+
+      // columns become the rows of the next pass
+      r01 = _mm256_permute2x128_si256(c01, c45, 0x20);
+      r45 = _mm256_permute2x128_si256(c01, c45, 0x31);
+      r23 = _mm256_permute2x128_si256(c23, c67, 0x20);
+      r67 = _mm256_permute2x128_si256(c23, c67, 0x31);
+   }
+
+   // row pass
+   dct_pass(bias_1, 17);
+
+   {
+      // pack, then gather the bytes of each output row. every lane holds
+      // 4 columns of all 8 rows: rows 0,7,1,6 in p and 2,5,3,4 in q.
+      __m256i p = _mm256_packus_epi16(r07, r16);
+      __m256i q = _mm256_packus_epi16(r25, r34);
+      #define dct_gather(k) \
+         (k), (k)+8, -1, -1, -1, -1, (k)+12, (k)+4, \
+         (k)+1, (k)+9, -1, -1, -1, -1, (k)+13, (k)+5
+      #define dct_gather_q(k) \
+         -1, -1, (k), (k)+8, (k)+12, (k)+4, -1, -1, \
+         -1, -1, (k)+1, (k)+9, (k)+13, (k)+5, -1, -1
+      __m256i o01 = _mm256_or_si256(
+         _mm256_shuffle_epi8(p, _mm256_setr_epi8(dct_gather(0), dct_gather(0))),
+         _mm256_shuffle_epi8(q, _mm256_setr_epi8(dct_gather_q(0), dct_gather_q(0))));
+      __m256i o23 = _mm256_or_si256(
+         _mm256_shuffle_epi8(p, _mm256_setr_epi8(dct_gather(2), dct_gather(2))),
+         _mm256_shuffle_epi8(q, _mm256_setr_epi8(dct_gather_q(2), dct_gather_q(2))));
+      __m128i o45 = _mm256_extracti128_si256(o01, 1);
+      __m128i o67 = _mm256_extracti128_si256(o23, 1);
+
+      // store
+      _mm_storel_epi64((__m128i *) out, _mm256_castsi256_si128(o01)); out += out_stride;
+      _mm_storeh_pd((double *) out, _mm_castsi128_pd(_mm256_castsi256_si128(o01))); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, _mm256_castsi256_si128(o23)); out += out_stride;
+      _mm_storeh_pd((double *) out, _mm_castsi128_pd(_mm256_castsi256_si128(o23))); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, o45); out += out_stride;
+      _mm_storeh_pd((double *) out, _mm_castsi128_pd(o45)); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, o67); out += out_stride;
+      _mm_storeh_pd((double *) out, _mm_castsi128_pd(o67));
+   }
+
+#undef dct_const
+#undef dct_rot
+#undef dct_widen
+#undef dct_bfly32o
+#undef dct_pass
+#undef dct_gather
+#undef dct_gather_q
+}
+#endif // STBI_AVX2
+
 #ifdef STBI_NEON
 
 // NEON integer IDCT. should produce bit-identical
@@ -2683,10 +3263,289 @@ static void stbi__jpeg_reset(stbi__jpeg *j)
    // since we don't even allow 1<<30 pixels
 }
 
+// the coefficients of block (i,j) of component n, progressive only
+static short *stbi__jpeg_coeff_block(stbi__jpeg *z, int n, int i, int j)
+{
+   return z->img_comp[n].coeff + (z->dc_only ? 1 : 64) * (i + j * z->img_comp[n].coeff_w);
+}
+
+// skip to the marker after the entropy-coded data without decoding it
+static void stbi__skip_entropy_coded_data(stbi__jpeg *z)
+{
+   while (!stbi__at_eof(z->s)) {
+      if (stbi__get8(z->s) == 0xff) {
+         int c = stbi__get8(z->s);
+         while (c == 0xff) c = stbi__get8(z->s); // consume fill bytes
+         // stuffed zeroes and restart markers are part of the data
+         if (c != 0 && !STBI__RESTART(c)) {
+            z->marker = (unsigned char) c;
+            return;
+         }
+      }
+   }
+}
+
+#ifdef STBI_THREADS
+// decodes MCU m of a baseline scan, counting in scan order
+static int stbi__jpeg_decode_mcu(stbi__jpeg *z, int m)
+{
+   STBI_SIMD_ALIGN(short, data[64]);
+   int bs = 8 >> z->scale_shift;
+   if (z->scan_n == 1) {
+      int n = z->order[0];
+      int w = (z->img_comp[n].x+7) >> 3;
+      int i = m % w, j = m / w;
+      int ha = z->img_comp[n].ha;
+      if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
+      z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*(j*bs - z->img_comp[n].y0)+i*bs, z->img_comp[n].w2, data);
+   } else {
+      int i = m % z->img_mcu_x, j = m / z->img_mcu_x;
+      int k,x,y;
+      for (k=0; k < z->scan_n; ++k) {
+         int n = z->order[k];
+         for (y=0; y < z->img_comp[n].v; ++y) {
+            for (x=0; x < z->img_comp[n].h; ++x) {
+               int x2 = (i*z->img_comp[n].h + x)*bs;
+               int y2 = (j*z->img_comp[n].v + y)*bs;
+               int ha = z->img_comp[n].ha;
+               if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
+               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*(y2 - z->img_comp[n].y0)+x2, z->img_comp[n].w2, data);
+            }
+         }
+      }
+   }
+   return 1;
+}
+
+// the restart intervals of a baseline scan can be decoded independently of
+// each other. their markers are found by scanning ahead, then a pool of
+// threads takes the intervals in turn, a band of them at a time when the
+// rows are passed on as they're done
+typedef struct
+{
+   stbi__jpeg *z;
+   stbi_uc **start;       // where each interval starts
+   stbi_uc *end;          // just past the marker that ends the scan
+   int marker;            // and that marker
+   int intervals, mcus;   // in the scan
+   int grab;              // intervals a thread takes at once
+   int band;              // counts bands, so a thread joins each only once
+   int next, last;        // the next interval of the band, and its end
+   int y0[4];             // the window of the band
+   int busy, quit, failed;
+   const char *failure;
+   stbi__mutex mutex;
+   stbi__cond cond;       // signaled whenever any of the above changes
+} stbi__jpeg_pool;
+
+typedef struct
+{
+   stbi__jpeg z;          // a decoder and context of each thread's own
+   stbi__context s;
+   stbi__jpeg_pool *q;
+   stbi__thread thread;
+} stbi__jpeg_worker;
+
+// fails unless there are just as many intervals as the MCUs need, so that
+// damaged scans are left to the serial decoder
+static int stbi__jpeg_find_intervals(stbi__jpeg_pool *q, stbi_uc *p, stbi_uc *end)
+{
+   int k = 0;
+   q->start[k++] = p;
+   for (;;) {
+      int c;
+      p = (stbi_uc *) memchr(p, 0xff, end - p);
+      if (p == NULL) return 0;
+      ++p;
+      while (p < end && *p == 0xff) ++p; // fill bytes
+      if (p == end) return 0;
+      c = *p++;
+      if (c == 0) continue; // stuffed zero
+      if (STBI__RESTART(c)) {
+         if (k == q->intervals) return 0;
+         q->start[k++] = p;
+      } else {
+         q->end = p;
+         q->marker = c;
+         return k == q->intervals;
+      }
+   }
+}
+
+// decodes intervals of the given band until there are none left
+static void stbi__jpeg_pool_work(stbi__jpeg_pool *q, stbi__jpeg *z, int band)
+{
+   for (;;) {
+      int k, last;
+      stbi__mutex_lock(&q->mutex);
+      k = q->band == band && !q->failed ? q->next : q->last;
+      last = q->last - k > q->grab ? k + q->grab : q->last;
+      q->next = last;
+      stbi__mutex_unlock(&q->mutex);
+      if (k >= last) return;
+      for (; k < last; ++k) {
+         int m = k * z->restart_interval;
+         int end = q->mcus - m > z->restart_interval ? m + z->restart_interval : q->mcus;
+         z->s->img_buffer = q->start[k];
+         z->s->img_buffer_end = q->end;
+         stbi__jpeg_reset(z);
+         for (; m < end; ++m) {
+            if (!stbi__jpeg_decode_mcu(z, m)) {
+               stbi__mutex_lock(&q->mutex);
+               if (!q->failed) q->failure = stbi__g_failure_reason;
+               q->failed = 1;
+               stbi__mutex_unlock(&q->mutex);
+               return;
+            }
+         }
+      }
+   }
+}
+
+STBI__THREAD_PROC(stbi__jpeg_pool_thread, arg)
+{
+   stbi__jpeg_worker *w = (stbi__jpeg_worker *) arg;
+   stbi__jpeg_pool *q = w->q;
+   int band = 0, k;
+   stbi__mutex_lock(&q->mutex);
+   for (;;) {
+      while (q->band == band && !q->quit)
+         stbi__cond_wait(&q->cond, &q->mutex);
+      if (q->quit) break;
+      band = q->band;
+      for (k=0; k < 4; ++k)
+         w->z.img_comp[k].y0 = q->y0[k];
+      ++q->busy;
+      stbi__mutex_unlock(&q->mutex);
+      stbi__jpeg_pool_work(q, &w->z, band);
+      stbi__mutex_lock(&q->mutex);
+      --q->busy;
+      stbi__cond_broadcast(&q->cond);
+   }
+   stbi__mutex_unlock(&q->mutex);
+   STBI__THREAD_RETURN;
+}
+
+// returns -1 if the scan has to be decoded serially after all
+static int stbi__jpeg_parse_parallel(stbi__jpeg *z)
+{
+   stbi__jpeg_pool q;
+   stbi__jpeg_worker *w;
+   int threads, started, band, first, k, ok = 1;
+   int n = z->order[0];
+   int x = z->scan_n == 1 ? (z->img_comp[n].x+7) >> 3 : z->img_mcu_x;
+   int y = z->scan_n == 1 ? (z->img_comp[n].y+7) >> 3 : z->img_mcu_y;
+
+   // the markers can only be found ahead of time if the file is in memory
+   if (!z->restart_interval || z->s->io.read || (z->window && !z->band)) return -1;
+   threads = stbi__load_threads();
+   q.mcus = x * y;
+   q.intervals = (q.mcus - 1) / z->restart_interval + 1;
+   if (threads < 2 || q.intervals < 2) return -1;
+   if (threads > q.intervals) threads = q.intervals;
+   q.start = (stbi_uc **) stbi__malloc(sizeof(stbi_uc *) * q.intervals);
+   w = (stbi__jpeg_worker *) stbi__malloc_mad2(threads, sizeof(stbi__jpeg_worker), 0);
+   if (!q.start || !w || !stbi__jpeg_find_intervals(&q, z->s->img_buffer, z->s->img_buffer_end)) {
+      STBI_FREE(q.start);
+      STBI_FREE(w);
+      return -1;
+   }
+   if (!stbi__mutex_init(&q.mutex)) {
+      STBI_FREE(q.start);
+      STBI_FREE(w);
+      return -1;
+   }
+   if (!stbi__cond_init(&q.cond)) {
+      stbi__mutex_destroy(&q.mutex);
+      STBI_FREE(q.start);
+      STBI_FREE(w);
+      return -1;
+   }
+   q.z = z;
+   q.grab = (16 + z->restart_interval - 1) / z->restart_interval;
+   q.band = 0;
+   q.next = q.last = 0;
+   q.busy = q.quit = q.failed = 0;
+   q.failure = NULL;
+   for (k=0; k < threads; ++k) {
+      w[k].z = *z;
+      w[k].s = *z->s;
+      w[k].z.s = &w[k].s;
+      w[k].q = &q;
+   }
+   // this thread is one of them
+   for (started = 1; started < threads; ++started)
+      if (!stbi__thread_create(&w[started].thread, stbi__jpeg_pool_thread, &w[started])) break;
+
+   band = z->band ? z->band : q.intervals;
+   for (first = 0; ok && first < q.intervals; first += band) {
+      int last = q.intervals - first > band ? first + band : q.intervals;
+      int mcus = q.mcus - last * z->restart_interval > 0 ? last * z->restart_interval : q.mcus;
+      if (z->stream) {
+         // the window has to reach the last MCU row the band touches
+         int bs = 8 >> z->scale_shift;
+         for (k=0; k < z->s->img_n; ++k) {
+            int rows = z->scan_n > 1 ? z->img_comp[k].v * bs : bs;
+            if (((mcus - 1) / x + 1) * rows - z->img_comp[k].y0 > z->img_comp[k].h2) {
+               ok = stbi__err("bad window", "Corrupt JPEG");
+               break;
+            }
+         }
+         if (!ok) break;
+      }
+      stbi__mutex_lock(&q.mutex);
+      ++q.band;
+      q.next = first;
+      q.last = last;
+      for (k=0; k < 4; ++k)
+         q.y0[k] = w[0].z.img_comp[k].y0 = z->img_comp[k].y0;
+      stbi__cond_broadcast(&q.cond);
+      stbi__mutex_unlock(&q.mutex);
+      stbi__jpeg_pool_work(&q, &w[0].z, q.band);
+      stbi__mutex_lock(&q.mutex);
+      while (q.busy > 0)
+         stbi__cond_wait(&q.cond, &q.mutex);
+      ok = !q.failed;
+      stbi__mutex_unlock(&q.mutex);
+      if (!ok) {
+         stbi__g_failure_reason = q.failure;
+      } else if (z->stream) {
+         // the last MCU row may only be partly decoded
+         z->filled = (mcus - 1) / x + 1;
+         ok = stbi__jpeg_stream_rows(z, mcus / x);
+      }
+   }
+
+   stbi__mutex_lock(&q.mutex);
+   q.quit = 1;
+   stbi__cond_broadcast(&q.cond);
+   stbi__mutex_unlock(&q.mutex);
+   for (k=1; k < started; ++k)
+      stbi__thread_join(w[k].thread);
+   stbi__cond_destroy(&q.cond);
+   stbi__mutex_destroy(&q.mutex);
+   STBI_FREE(q.start);
+   STBI_FREE(w);
+   if (ok) {
+      // where the serial decoder would have stopped
+      z->s->img_buffer = q.end;
+      z->marker = (unsigned char) q.marker;
+   }
+   return ok;
+}
+#endif
+
 static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
 {
+   #ifdef STBI_THREADS
+   if (!z->progressive) {
+      int r = stbi__jpeg_parse_parallel(z);
+      if (r >= 0) return r;
+   }
+   #endif
    stbi__jpeg_reset(z);
    if (!z->progressive) {
+      int bs = 8 >> z->scale_shift;
       if (z->scan_n == 1) {
          int i,j;
          STBI_SIMD_ALIGN(short, data[64]);
@@ -2701,7 +3560,7 @@ static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
             for (i=0; i < w; ++i) {
                int ha = z->img_comp[n].ha;
                if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
-               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*(j*bs - z->img_comp[n].y0)+i*bs, z->img_comp[n].w2, data);
                // every data block is an MCU, so countdown the restart interval
                if (--z->todo <= 0) {
                   if (z->code_bits < 24) stbi__grow_buffer_unsafe(z);
@@ -2711,6 +3570,7 @@ static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
                   stbi__jpeg_reset(z);
                }
             }
+            if (z->stream && !stbi__jpeg_stream_rows(z, j+1)) return 0;
          }
          return 1;
       } else { // interleaved
@@ -2725,11 +3585,11 @@ static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
                   // by the basic H and V specified for the component
                   for (y=0; y < z->img_comp[n].v; ++y) {
                      for (x=0; x < z->img_comp[n].h; ++x) {
-                        int x2 = (i*z->img_comp[n].h + x)*8;
-                        int y2 = (j*z->img_comp[n].v + y)*8;
+                        int x2 = (i*z->img_comp[n].h + x)*bs;
+                        int y2 = (j*z->img_comp[n].v + y)*bs;
                         int ha = z->img_comp[n].ha;
                         if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
-                        z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*y2+x2, z->img_comp[n].w2, data);
+                        z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*(y2 - z->img_comp[n].y0)+x2, z->img_comp[n].w2, data);
                      }
                   }
                }
@@ -2741,6 +3601,7 @@ static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
                   stbi__jpeg_reset(z);
                }
             }
+            if (z->stream && !stbi__jpeg_stream_rows(z, j+1)) return 0;
          }
          return 1;
       }
@@ -2756,7 +3617,7 @@ static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
          int h = (z->img_comp[n].y+7) >> 3;
          for (j=0; j < h; ++j) {
             for (i=0; i < w; ++i) {
-               short *data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
+               short *data = stbi__jpeg_coeff_block(z, n, i, j);
                if (z->spec_start == 0) {
                   if (!stbi__jpeg_decode_block_prog_dc(z, data, &z->huff_dc[z->img_comp[n].hd], n))
                      return 0;
@@ -2787,7 +3648,7 @@ static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
                      for (x=0; x < z->img_comp[n].h; ++x) {
                         int x2 = (i*z->img_comp[n].h + x);
                         int y2 = (j*z->img_comp[n].v + y);
-                        short *data = z->img_comp[n].coeff + 64 * (x2 + y2 * z->img_comp[n].coeff_w);
+                        short *data = stbi__jpeg_coeff_block(z, n, x2, y2);
                         if (!stbi__jpeg_decode_block_prog_dc(z, data, &z->huff_dc[z->img_comp[n].hd], n))
                            return 0;
                      }
@@ -2819,14 +3680,18 @@ static void stbi__jpeg_finish(stbi__jpeg *z)
    if (z->progressive) {
       // dequantize and idct the data
       int i,j,n;
+      int bs = 8 >> z->scale_shift;
       for (n=0; n < z->s->img_n; ++n) {
          int w = (z->img_comp[n].x+7) >> 3;
          int h = (z->img_comp[n].y+7) >> 3;
          for (j=0; j < h; ++j) {
             for (i=0; i < w; ++i) {
-               short *data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
-               stbi__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
-               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+               short *data = stbi__jpeg_coeff_block(z, n, i, j);
+               if (z->dc_only)
+                  data[0] *= z->dequant[z->img_comp[n].tq][0];
+               else
+                  stbi__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
+               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*bs+i*bs, z->img_comp[n].w2, data);
             }
          }
       }
@@ -2997,6 +3862,21 @@ static int stbi__free_jpeg_components(stbi__jpeg *z, int ncomp, int why)
    return why;
 }
 
+// the smallest scale that still meets the requested size
+static int stbi__jpeg_scale_shift(stbi__context *s)
+{
+   int shift = 0;
+   if (stbi__min_load_x > 0 || stbi__min_load_y > 0) {
+      while (shift < 3) {
+         int next = shift + 1;
+         if ((int) ((s->img_x + (1 << next) - 1) >> next) < stbi__min_load_x) break;
+         if ((int) ((s->img_y + (1 << next) - 1) >> next) < stbi__min_load_y) break;
+         shift = next;
+      }
+   }
+   return shift;
+}
+
 static int stbi__process_frame_header(stbi__jpeg *z, int scan)
 {
    stbi__context *s = z->s;
@@ -3031,11 +3911,21 @@ static int stbi__process_frame_header(stbi__jpeg *z, int scan)
 
    if (!stbi__mad3sizes_valid(s->img_x, s->img_y, s->img_n, 0)) return stbi__err("too large", "Image too large to decode");
 
+   z->window = z->rows && !z->progressive;
+
    for (i=0; i < s->img_n; ++i) {
       if (z->img_comp[i].h > h_max) h_max = z->img_comp[i].h;
       if (z->img_comp[i].v > v_max) v_max = z->img_comp[i].v;
    }
 
+   z->scale_shift = stbi__jpeg_scale_shift(s);
+   z->dc_only = z->progressive && z->scale_shift == 3;
+   switch (z->scale_shift) {
+      case 1: z->idct_block_kernel = stbi__idct_block_4x4; break;
+      case 2: z->idct_block_kernel = stbi__idct_block_2x2; break;
+      case 3: z->idct_block_kernel = stbi__idct_block_1x1; break;
+   }
+
    // compute interleaved mcu info
    z->img_h_max = h_max;
    z->img_v_max = v_max;
@@ -3056,21 +3946,31 @@ static int stbi__process_frame_header(stbi__jpeg *z, int scan)
       //
       // img_mcu_x, img_mcu_y: <=17 bits; comp[i].h and .v are <=4 (checked earlier)
       // so these muls can't overflow with 32-bit ints (which we require)
-      z->img_comp[i].w2 = z->img_mcu_x * z->img_comp[i].h * 8;
-      z->img_comp[i].h2 = z->img_mcu_y * z->img_comp[i].v * 8;
+      z->img_comp[i].w2 = (z->img_mcu_x * z->img_comp[i].h * 8) >> z->scale_shift;
+      z->img_comp[i].h2 = (z->img_mcu_y * z->img_comp[i].v * 8) >> z->scale_shift;
+      z->img_comp[i].y0 = 0;
+      if (z->window) {
+         // the MCU row being decoded, plus what upsampling needs from the last
+         int window = (z->img_comp[i].v * 8 * 2) >> z->scale_shift;
+         if (z->img_comp[i].h2 > window) z->img_comp[i].h2 = window;
+      }
       z->img_comp[i].coeff = 0;
       z->img_comp[i].raw_coeff = 0;
       z->img_comp[i].linebuf = NULL;
+      z->img_comp[i].dc_done = 0;
       z->img_comp[i].raw_data = stbi__malloc_mad2(z->img_comp[i].w2, z->img_comp[i].h2, 15);
       if (z->img_comp[i].raw_data == NULL)
          return stbi__free_jpeg_components(z, i+1, stbi__err("outofmem", "Out of memory"));
       // align blocks for idct using mmx/sse
       z->img_comp[i].data = (stbi_uc*) (((size_t) z->img_comp[i].raw_data + 15) & ~15);
       if (z->progressive) {
-         // w2, h2 are multiples of 8 (see above)
-         z->img_comp[i].coeff_w = z->img_comp[i].w2 / 8;
-         z->img_comp[i].coeff_h = z->img_comp[i].h2 / 8;
-         z->img_comp[i].raw_coeff = stbi__malloc_mad3(z->img_comp[i].w2, z->img_comp[i].h2, sizeof(short), 15);
+         // coefficients are stored at full scale, even if w2, h2 are not
+         z->img_comp[i].coeff_w = z->img_mcu_x * z->img_comp[i].h;
+         z->img_comp[i].coeff_h = z->img_mcu_y * z->img_comp[i].v;
+         if (z->dc_only)
+            z->img_comp[i].raw_coeff = stbi__malloc_mad3(z->img_comp[i].coeff_w, z->img_comp[i].coeff_h, sizeof(short), 15);
+         else
+            z->img_comp[i].raw_coeff = stbi__malloc_mad3(z->img_comp[i].coeff_w * 8, z->img_comp[i].coeff_h * 8, sizeof(short), 15);
          if (z->img_comp[i].raw_coeff == NULL)
             return stbi__free_jpeg_components(z, i+1, stbi__err("outofmem", "Out of memory"));
          z->img_comp[i].coeff = (short*) (((size_t) z->img_comp[i].raw_coeff + 15) & ~15);
@@ -3127,7 +4027,25 @@ static int stbi__decode_jpeg_image(stbi__jpeg *j)
    while (!stbi__EOI(m)) {
       if (stbi__SOS(m)) {
          if (!stbi__process_scan_header(j)) return 0;
-         if (!stbi__parse_entropy_coded_data(j)) return 0;
+         if (j->window && !j->stream && !stbi__jpeg_stream_start(j)) return 0;
+         if (j->stream) {
+            // the whole image is in this scan
+            if (!stbi__parse_entropy_coded_data(j)) return 0;
+            return stbi__jpeg_stream_rows(j, -1);
+         }
+         if (j->dc_only && j->spec_start != 0)
+            stbi__skip_entropy_coded_data(j);
+         else if (!stbi__parse_entropy_coded_data(j))
+            return 0;
+         if (j->dc_only && j->spec_start == 0 && j->succ_low == 0) {
+            // that was the last bit of the DC for these components
+            int k, done = 1;
+            for (k=0; k < j->scan_n; ++k)
+               j->img_comp[j->order[k]].dc_done = 1;
+            for (k=0; k < j->s->img_n; ++k)
+               done = done && j->img_comp[k].dc_done;
+            if (done) break;
+         }
          if (j->marker == STBI__MARKER_none ) {
             // handle 0s at the end of image data from IP Kamera 9060
             while (!stbi__at_eof(j->s)) {
@@ -3351,6 +4269,76 @@ static stbi_uc *stbi__resample_row_hv_2_simd(stbi_uc *out, stbi_uc *in_near, stb
 }
 #endif
 
+#ifdef STBI_AVX2
+// the sse2 loop above, 16 pixels at a time
+static STBI__AVX2_TARGET stbi_uc *stbi__resample_row_hv_2_avx2(stbi_uc *out, stbi_uc *in_near, stbi_uc *in_far, int w, int hs)
+{
+   int i=0,t0,t1;
+
+   if (w == 1) {
+      out[0] = out[1] = stbi__div4(3*in_near[0] + in_far[0] + 2);
+      return out;
+   }
+
+   t1 = 3*in_near[0] + in_far[0];
+   for (; i < ((w-1) & ~15); i += 16) {
+      // vertical pass, 3*x + y = 4*x + (y - x)
+      __m256i farw  = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *) (in_far + i)));
+      __m256i nearw = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *) (in_near + i)));
+      __m256i diff  = _mm256_sub_epi16(farw, nearw);
+      __m256i nears = _mm256_slli_epi16(nearw, 2);
+      __m256i curr  = _mm256_add_epi16(nears, diff); // current row
+
+      // "prev" and "next" are the current row shifted by a pixel, which
+      // crosses the 128-bit lanes; the pixels shifted in come from t1 and
+      // from the first pixel of the next block of 16.
+      __m256i lo    = _mm256_permute2x128_si256(curr, curr, 0x08); // 0 | curr.lo
+      __m256i hi    = _mm256_permute2x128_si256(curr, curr, 0x81); // curr.hi | 0
+      __m256i prv0  = _mm256_alignr_epi8(curr, lo, 14);
+      __m256i nxt0  = _mm256_alignr_epi8(hi, curr, 2);
+      __m256i prev  = _mm256_insert_epi16(prv0, t1, 0);
+      __m256i next  = _mm256_insert_epi16(nxt0, 3*in_near[i+16] + in_far[i+16], 15);
+
+      // horizontal filter, even = cur*4 + (prev - cur), odd = cur*4 + (next - cur)
+      __m256i bias  = _mm256_set1_epi16(8);
+      __m256i curs  = _mm256_slli_epi16(curr, 2);
+      __m256i prvd  = _mm256_sub_epi16(prev, curr);
+      __m256i nxtd  = _mm256_sub_epi16(next, curr);
+      __m256i curb  = _mm256_add_epi16(curs, bias);
+      __m256i even  = _mm256_add_epi16(prvd, curb);
+      __m256i odd   = _mm256_add_epi16(nxtd, curb);
+
+      // interleave even and odd pixels, then undo scaling. each lane packs
+      // back to its own 8 input pixels, so the output stays in order.
+      __m256i int0  = _mm256_unpacklo_epi16(even, odd);
+      __m256i int1  = _mm256_unpackhi_epi16(even, odd);
+      __m256i de0   = _mm256_srli_epi16(int0, 4);
+      __m256i de1   = _mm256_srli_epi16(int1, 4);
+      __m256i outv  = _mm256_packus_epi16(de0, de1);
+      _mm256_storeu_si256((__m256i *) (out + i*2), outv);
+
+      // "previous" value for next iter
+      t1 = 3*in_near[i+15] + in_far[i+15];
+   }
+
+   t0 = t1;
+   t1 = 3*in_near[i] + in_far[i];
+   out[i*2] = stbi__div16(3*t1 + t0 + 8);
+
+   for (++i; i < w; ++i) {
+      t0 = t1;
+      t1 = 3*in_near[i]+in_far[i];
+      out[i*2-1] = stbi__div16(3*t0 + t1 + 8);
+      out[i*2  ] = stbi__div16(3*t1 + t0 + 8);
+   }
+   out[w*2-1] = stbi__div4(t1+2);
+
+   STBI_NOTUSED(hs);
+
+   return out;
+}
+#endif
+
 static stbi_uc *stbi__resample_row_generic(stbi_uc *out, stbi_uc *in_near, stbi_uc *in_far, int w, int hs)
 {
    // resample with nearest-neighbor
@@ -3525,12 +4513,83 @@ static void stbi__YCbCr_to_RGB_simd(stbi_uc *out, stbi_uc const *y, stbi_uc cons
 }
 #endif
 
+#ifdef STBI_AVX2
+// the sse2 step == 4 loop, 16 pixels at a time. leftovers go to the sse2
+// version.
+static STBI__AVX2_TARGET void stbi__YCbCr_to_RGB_avx2(stbi_uc *out, stbi_uc const *y, stbi_uc const *pcb, stbi_uc const *pcr, int count, int step)
+{
+   int i = 0;
+
+   if (step == 4) {
+      __m256i signflip  = _mm256_set1_epi8(-0x80);
+      __m256i cr_const0 = _mm256_set1_epi16(   (short) ( 1.40200f*4096.0f+0.5f));
+      __m256i cr_const1 = _mm256_set1_epi16( - (short) ( 0.71414f*4096.0f+0.5f));
+      __m256i cb_const0 = _mm256_set1_epi16( - (short) ( 0.34414f*4096.0f+0.5f));
+      __m256i cb_const1 = _mm256_set1_epi16(   (short) ( 1.77200f*4096.0f+0.5f));
+      __m256i y_bias = _mm256_set1_epi8((char) (unsigned char) 128);
+      __m256i xw = _mm256_set1_epi16(255); // alpha channel
+
+      for (; i+15 < count; i += 16) {
+         // load, with pixels 0-7 in the low half of the low lane and 8-15
+         // in the low half of the high lane, where unpacklo finds them
+         __m256i y_bytes  = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *) (y+i))), 0x50);
+         __m256i cr_bytes = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *) (pcr+i))), 0x50);
+         __m256i cb_bytes = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *) (pcb+i))), 0x50);
+         __m256i cr_biased = _mm256_xor_si256(cr_bytes, signflip); // -128
+         __m256i cb_biased = _mm256_xor_si256(cb_bytes, signflip); // -128
+
+         // unpack to short (and left-shift cr, cb by 8)
+         __m256i yw  = _mm256_unpacklo_epi8(y_bias, y_bytes);
+         __m256i crw = _mm256_unpacklo_epi8(_mm256_setzero_si256(), cr_biased);
+         __m256i cbw = _mm256_unpacklo_epi8(_mm256_setzero_si256(), cb_biased);
+
+         // color transform
+         __m256i yws = _mm256_srli_epi16(yw, 4);
+         __m256i cr0 = _mm256_mulhi_epi16(cr_const0, crw);
+         __m256i cb0 = _mm256_mulhi_epi16(cb_const0, cbw);
+         __m256i cb1 = _mm256_mulhi_epi16(cbw, cb_const1);
+         __m256i cr1 = _mm256_mulhi_epi16(crw, cr_const1);
+         __m256i rws = _mm256_add_epi16(cr0, yws);
+         __m256i gwt = _mm256_add_epi16(cb0, yws);
+         __m256i bws = _mm256_add_epi16(yws, cb1);
+         __m256i gws = _mm256_add_epi16(gwt, cr1);
+
+         // descale
+         __m256i rw = _mm256_srai_epi16(rws, 4);
+         __m256i bw = _mm256_srai_epi16(bws, 4);
+         __m256i gw = _mm256_srai_epi16(gws, 4);
+
+         // back to byte, set up for transpose
+         __m256i brb = _mm256_packus_epi16(rw, bw);
+         __m256i gxb = _mm256_packus_epi16(gw, xw);
+
+         // transpose to interleave channels: pixels 0-3 | 8-11 and 4-7 | 12-15
+         __m256i t0 = _mm256_unpacklo_epi8(brb, gxb);
+         __m256i t1 = _mm256_unpackhi_epi8(brb, gxb);
+         __m256i o0 = _mm256_unpacklo_epi16(t0, t1);
+         __m256i o1 = _mm256_unpackhi_epi16(t0, t1);
+
+         // store
+         _mm256_storeu_si256((__m256i *) (out + 0), _mm256_permute2x128_si256(o0, o1, 0x20));
+         _mm256_storeu_si256((__m256i *) (out + 32), _mm256_permute2x128_si256(o0, o1, 0x31));
+         out += 64;
+      }
+   }
+
+   stbi__YCbCr_to_RGB_simd(out, y+i, pcb+i, pcr+i, count-i, step);
+}
+#endif
+
 // set up the kernels
 static void stbi__setup_jpeg(stbi__jpeg *j)
 {
    j->idct_block_kernel = stbi__idct_block;
    j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_row;
    j->resample_row_hv_2_kernel = stbi__resample_row_hv_2;
+   j->rows = NULL;
+   j->stream = NULL;
+   j->band = 0;
+   j->filled = 0;
 
 #ifdef STBI_SSE2
    if (stbi__sse2_available()) {
@@ -3540,6 +4599,14 @@ static void stbi__setup_jpeg(stbi__jpeg *j)
    }
 #endif
 
+#ifdef STBI_AVX2
+   if (stbi__avx2_available()) {
+      j->idct_block_kernel = stbi__idct_avx2;
+      j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_avx2;
+      j->resample_row_hv_2_kernel = stbi__resample_row_hv_2_avx2;
+   }
+#endif
+
 #ifdef STBI_NEON
    j->idct_block_kernel = stbi__idct_simd;
    j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_simd;
@@ -3559,6 +4626,7 @@ typedef struct
    stbi_uc *line0,*line1;
    int hs,vs;   // expansion factor in each axis
    int w_lores; // horizontal pixels pre-expansion
+   int h_lores; // vertical pixels pre-expansion
    int ystep;   // how far through vertical expansion we are
    int ypos;    // which pre-expansion row we're on
 } stbi__resample;
@@ -3570,6 +4638,145 @@ static stbi_uc stbi__blinn_8x8(stbi_uc x, stbi_uc y)
    return (stbi_uc) ((t + (t >>8)) >> 8);
 }
 
+// the number of components to decode for n output channels
+static int stbi__jpeg_decode_n(stbi__jpeg *z, int n, int *is_rgb)
+{
+   *is_rgb = z->s->img_n == 3 && (z->rgb == 3 || (z->app14_color_transform == 0 && !z->jfif));
+
+   if (z->s->img_n == 3 && n < 3 && !*is_rgb)
+      return 1;
+   else
+      return z->s->img_n;
+}
+
+static int stbi__jpeg_setup_resample(stbi__jpeg *z, stbi__resample *res_comp, int decode_n, stbi__uint32 w)
+{
+   int k, round = (1 << z->scale_shift) - 1;
+   for (k=0; k < decode_n; ++k) {
+      stbi__resample *r = &res_comp[k];
+
+      // allocate line buffer big enough for upsampling off the edges
+      // with upsample factor of 4
+      z->img_comp[k].linebuf = (stbi_uc *) stbi__malloc(w + 3);
+      if (!z->img_comp[k].linebuf) return stbi__err("outofmem", "Out of memory");
+
+      r->hs      = z->img_h_max / z->img_comp[k].h;
+      r->vs      = z->img_v_max / z->img_comp[k].v;
+      r->ystep   = r->vs >> 1;
+      r->w_lores = (w + r->hs-1) / r->hs;
+      r->h_lores = (z->img_comp[k].y + round) >> z->scale_shift;
+      r->ypos    = 0;
+      r->line0   = r->line1 = z->img_comp[k].data;
+
+      if      (r->hs == 1 && r->vs == 1) r->resample = resample_row_1;
+      else if (r->hs == 1 && r->vs == 2) r->resample = stbi__resample_row_v_2;
+      else if (r->hs == 2 && r->vs == 1) r->resample = stbi__resample_row_h_2;
+      else if (r->hs == 2 && r->vs == 2) r->resample = z->resample_row_hv_2_kernel;
+      else                               r->resample = stbi__resample_row_generic;
+   }
+   return 1;
+}
+
+// resample and color-convert the next row of w pixels into out
+static void stbi__jpeg_convert_row(stbi__jpeg *z, stbi__resample *res_comp, stbi_uc *out, int n, int decode_n, int is_rgb, stbi__uint32 w)
+{
+   int k;
+   unsigned int i;
+   stbi_uc *coutput[4];
+
+   for (k=0; k < decode_n; ++k) {
+      stbi__resample *r = &res_comp[k];
+      int y_bot = r->ystep >= (r->vs >> 1);
+      coutput[k] = r->resample(z->img_comp[k].linebuf,
+                               y_bot ? r->line1 : r->line0,
+                               y_bot ? r->line0 : r->line1,
+                               r->w_lores, r->hs);
+      if (++r->ystep >= r->vs) {
+         r->ystep = 0;
+         r->line0 = r->line1;
+         if (++r->ypos < r->h_lores)
+            r->line1 += z->img_comp[k].w2;
+      }
+   }
+   if (n >= 3) {
+      stbi_uc *y = coutput[0];
+      if (z->s->img_n == 3) {
+         if (is_rgb) {
+            for (i=0; i < w; ++i) {
+               out[0] = y[i];
+               out[1] = coutput[1][i];
+               out[2] = coutput[2][i];
+               out[3] = 255;
+               out += n;
+            }
+         } else {
+            z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], w, n);
+         }
+      } else if (z->s->img_n == 4) {
+         if (z->app14_color_transform == 0) { // CMYK
+            for (i=0; i < w; ++i) {
+               stbi_uc m = coutput[3][i];
+               out[0] = stbi__blinn_8x8(coutput[0][i], m);
+               out[1] = stbi__blinn_8x8(coutput[1][i], m);
+               out[2] = stbi__blinn_8x8(coutput[2][i], m);
+               out[3] = 255;
+               out += n;
+            }
+         } else if (z->app14_color_transform == 2) { // YCCK
+            z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], w, n);
+            for (i=0; i < w; ++i) {
+               stbi_uc m = coutput[3][i];
+               out[0] = stbi__blinn_8x8(255 - out[0], m);
+               out[1] = stbi__blinn_8x8(255 - out[1], m);
+               out[2] = stbi__blinn_8x8(255 - out[2], m);
+               out += n;
+            }
+         } else { // YCbCr + alpha?  Ignore the fourth channel for now
+            z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], w, n);
+         }
+      } else
+         for (i=0; i < w; ++i) {
+            out[0] = out[1] = out[2] = y[i];
+            out[3] = 255; // not used if n==3
+            out += n;
+         }
+   } else {
+      if (is_rgb) {
+         if (n == 1)
+            for (i=0; i < w; ++i)
+               *out++ = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
+         else {
+            for (i=0; i < w; ++i, out += 2) {
+               out[0] = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
+               out[1] = 255;
+            }
+         }
+      } else if (z->s->img_n == 4 && z->app14_color_transform == 0) {
+         for (i=0; i < w; ++i) {
+            stbi_uc m = coutput[3][i];
+            stbi_uc r = stbi__blinn_8x8(coutput[0][i], m);
+            stbi_uc g = stbi__blinn_8x8(coutput[1][i], m);
+            stbi_uc b = stbi__blinn_8x8(coutput[2][i], m);
+            out[0] = stbi__compute_y(r, g, b);
+            out[1] = 255;
+            out += n;
+         }
+      } else if (z->s->img_n == 4 && z->app14_color_transform == 2) {
+         for (i=0; i < w; ++i) {
+            out[0] = stbi__blinn_8x8(255 - coutput[0][i], coutput[3][i]);
+            out[1] = 255;
+            out += n;
+         }
+      } else {
+         stbi_uc *y = coutput[0];
+         if (n == 1)
+            for (i=0; i < w; ++i) out[i] = y[i];
+         else
+            for (i=0; i < w; ++i) *out++ = y[i], *out++ = 255;
+      }
+   }
+}
+
 static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp, int req_comp)
 {
    int n, decode_n, is_rgb;
@@ -3581,146 +4788,41 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
    // load a jpeg image from whichever source, but leave in YCbCr format
    if (!stbi__decode_jpeg_image(z)) { stbi__cleanup_jpeg(z); return NULL; }
 
+   // the rows have been passed on already
+   if (z->stream) {
+      z->rows->done = 1;
+      stbi__cleanup_jpeg(z);
+      return NULL;
+   }
+
+   // from here on, work with the size the IDCT decoded to
+   if (z->scale_shift) {
+      int round = (1 << z->scale_shift) - 1;
+      z->s->img_x = (z->s->img_x + round) >> z->scale_shift;
+      z->s->img_y = (z->s->img_y + round) >> z->scale_shift;
+   }
+
    // determine actual number of components to generate
    n = req_comp ? req_comp : z->s->img_n >= 3 ? 3 : 1;
 
-   is_rgb = z->s->img_n == 3 && (z->rgb == 3 || (z->app14_color_transform == 0 && !z->jfif));
-
-   if (z->s->img_n == 3 && n < 3 && !is_rgb)
-      decode_n = 1;
-   else
-      decode_n = z->s->img_n;
+   decode_n = stbi__jpeg_decode_n(z, n, &is_rgb);
 
    // resample and color-convert
    {
-      int k;
-      unsigned int i,j;
+      unsigned int j;
       stbi_uc *output;
-      stbi_uc *coutput[4];
 
       stbi__resample res_comp[4];
 
-      for (k=0; k < decode_n; ++k) {
-         stbi__resample *r = &res_comp[k];
-
-         // allocate line buffer big enough for upsampling off the edges
-         // with upsample factor of 4
-         z->img_comp[k].linebuf = (stbi_uc *) stbi__malloc(z->s->img_x + 3);
-         if (!z->img_comp[k].linebuf) { stbi__cleanup_jpeg(z); return stbi__errpuc("outofmem", "Out of memory"); }
-
-         r->hs      = z->img_h_max / z->img_comp[k].h;
-         r->vs      = z->img_v_max / z->img_comp[k].v;
-         r->ystep   = r->vs >> 1;
-         r->w_lores = (z->s->img_x + r->hs-1) / r->hs;
-         r->ypos    = 0;
-         r->line0   = r->line1 = z->img_comp[k].data;
-
-         if      (r->hs == 1 && r->vs == 1) r->resample = resample_row_1;
-         else if (r->hs == 1 && r->vs == 2) r->resample = stbi__resample_row_v_2;
-         else if (r->hs == 2 && r->vs == 1) r->resample = stbi__resample_row_h_2;
-         else if (r->hs == 2 && r->vs == 2) r->resample = z->resample_row_hv_2_kernel;
-         else                               r->resample = stbi__resample_row_generic;
-      }
+      if (!stbi__jpeg_setup_resample(z, res_comp, decode_n, z->s->img_x)) { stbi__cleanup_jpeg(z); return NULL; }
 
       // can't error after this so, this is safe
       output = (stbi_uc *) stbi__malloc_mad3(n, z->s->img_x, z->s->img_y, 1);
       if (!output) { stbi__cleanup_jpeg(z); return stbi__errpuc("outofmem", "Out of memory"); }
 
       // now go ahead and resample
-      for (j=0; j < z->s->img_y; ++j) {
-         stbi_uc *out = output + n * z->s->img_x * j;
-         for (k=0; k < decode_n; ++k) {
-            stbi__resample *r = &res_comp[k];
-            int y_bot = r->ystep >= (r->vs >> 1);
-            coutput[k] = r->resample(z->img_comp[k].linebuf,
-                                     y_bot ? r->line1 : r->line0,
-                                     y_bot ? r->line0 : r->line1,
-                                     r->w_lores, r->hs);
-            if (++r->ystep >= r->vs) {
-               r->ystep = 0;
-               r->line0 = r->line1;
-               if (++r->ypos < z->img_comp[k].y)
-                  r->line1 += z->img_comp[k].w2;
-            }
-         }
-         if (n >= 3) {
-            stbi_uc *y = coutput[0];
-            if (z->s->img_n == 3) {
-               if (is_rgb) {
-                  for (i=0; i < z->s->img_x; ++i) {
-                     out[0] = y[i];
-                     out[1] = coutput[1][i];
-                     out[2] = coutput[2][i];
-                     out[3] = 255;
-                     out += n;
-                  }
-               } else {
-                  z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-               }
-            } else if (z->s->img_n == 4) {
-               if (z->app14_color_transform == 0) { // CMYK
-                  for (i=0; i < z->s->img_x; ++i) {
-                     stbi_uc m = coutput[3][i];
-                     out[0] = stbi__blinn_8x8(coutput[0][i], m);
-                     out[1] = stbi__blinn_8x8(coutput[1][i], m);
-                     out[2] = stbi__blinn_8x8(coutput[2][i], m);
-                     out[3] = 255;
-                     out += n;
-                  }
-               } else if (z->app14_color_transform == 2) { // YCCK
-                  z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-                  for (i=0; i < z->s->img_x; ++i) {
-                     stbi_uc m = coutput[3][i];
-                     out[0] = stbi__blinn_8x8(255 - out[0], m);
-                     out[1] = stbi__blinn_8x8(255 - out[1], m);
-                     out[2] = stbi__blinn_8x8(255 - out[2], m);
-                     out += n;
-                  }
-               } else { // YCbCr + alpha?  Ignore the fourth channel for now
-                  z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-               }
-            } else
-               for (i=0; i < z->s->img_x; ++i) {
-                  out[0] = out[1] = out[2] = y[i];
-                  out[3] = 255; // not used if n==3
-                  out += n;
-               }
-         } else {
-            if (is_rgb) {
-               if (n == 1)
-                  for (i=0; i < z->s->img_x; ++i)
-                     *out++ = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
-               else {
-                  for (i=0; i < z->s->img_x; ++i, out += 2) {
-                     out[0] = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
-                     out[1] = 255;
-                  }
-               }
-            } else if (z->s->img_n == 4 && z->app14_color_transform == 0) {
-               for (i=0; i < z->s->img_x; ++i) {
-                  stbi_uc m = coutput[3][i];
-                  stbi_uc r = stbi__blinn_8x8(coutput[0][i], m);
-                  stbi_uc g = stbi__blinn_8x8(coutput[1][i], m);
-                  stbi_uc b = stbi__blinn_8x8(coutput[2][i], m);
-                  out[0] = stbi__compute_y(r, g, b);
-                  out[1] = 255;
-                  out += n;
-               }
-            } else if (z->s->img_n == 4 && z->app14_color_transform == 2) {
-               for (i=0; i < z->s->img_x; ++i) {
-                  out[0] = stbi__blinn_8x8(255 - coutput[0][i], coutput[3][i]);
-                  out[1] = 255;
-                  out += n;
-               }
-            } else {
-               stbi_uc *y = coutput[0];
-               if (n == 1)
-                  for (i=0; i < z->s->img_x; ++i) out[i] = y[i];
-               else
-                  for (i=0; i < z->s->img_x; ++i) *out++ = y[i], *out++ = 255;
-            }
-         }
-      }
+      for (j=0; j < z->s->img_y; ++j)
+         stbi__jpeg_convert_row(z, res_comp, output + n * z->s->img_x * j, n, decode_n, is_rgb, z->s->img_x);
       stbi__cleanup_jpeg(z);
       *out_x = z->s->img_x;
       *out_y = z->s->img_y;
@@ -3729,11 +4831,140 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
    }
 }
 
+typedef struct stbi__jpeg_stream
+{
+   stbi__resample res_comp[4];
+   stbi_uc *out;               // one output row
+   int n, decode_n, is_rgb;
+   stbi__uint32 w, h, y;       // output size and the next row
+   int unit, units;            // MCU rows decoded and in all, or block rows
+   int interleaved;
+} stbi__jpeg_stream;
+
+static int stbi__jpeg_stream_start(stbi__jpeg *z)
+{
+   stbi__jpeg_stream *p;
+   int k, round = (1 << z->scale_shift) - 1;
+   if (z->scan_n != z->s->img_n) {
+      // components in separate scans need the whole planes after all
+      z->window = 0;
+      for (k=0; k < z->s->img_n; ++k) {
+         STBI_FREE(z->img_comp[k].raw_data);
+         z->img_comp[k].h2 = (z->img_mcu_y * z->img_comp[k].v * 8) >> z->scale_shift;
+         z->img_comp[k].raw_data = stbi__malloc_mad2(z->img_comp[k].w2, z->img_comp[k].h2, 15);
+         z->img_comp[k].data = NULL;
+         if (z->img_comp[k].raw_data == NULL) return stbi__err("outofmem", "Out of memory");
+         z->img_comp[k].data = (stbi_uc*) (((size_t) z->img_comp[k].raw_data + 15) & ~15);
+      }
+      return 1;
+   }
+   #ifdef STBI_THREADS
+   if (z->restart_interval && !z->s->io.read && stbi__load_threads() > 1) {
+      // the thread pool decodes bands of at least a few MCU rows, so the
+      // window has to hold the rows of a band, the partly decoded one before
+      // them and the one above that upsampling needs
+      int bs = 8 >> z->scale_shift, r = z->restart_interval;
+      int x = z->scan_n == 1 ? (z->img_comp[z->order[0]].x+7) >> 3 : z->img_mcu_x;
+      int y = z->scan_n == 1 ? (z->img_comp[z->order[0]].y+7) >> 3 : z->img_mcu_y;
+      int intervals = (x * y - 1) / r + 1, units;
+      z->band = stbi__load_threads() * 4;
+      if (z->band < (4 * x + r - 1) / r) z->band = (4 * x + r - 1) / r;
+      if (z->band > intervals) z->band = intervals;
+      units = (z->band * r + x - 2) / x + 3;
+      for (k=0; k < z->s->img_n; ++k) {
+         int rows = z->scan_n > 1 ? z->img_comp[k].v * bs : bs;
+         int h2 = (z->img_mcu_y * z->img_comp[k].v * 8) >> z->scale_shift;
+         if (h2 > units * rows) h2 = units * rows;
+         if (h2 <= z->img_comp[k].h2) continue;
+         STBI_FREE(z->img_comp[k].raw_data);
+         z->img_comp[k].h2 = h2;
+         z->img_comp[k].raw_data = stbi__malloc_mad2(z->img_comp[k].w2, h2, 15);
+         z->img_comp[k].data = NULL;
+         if (z->img_comp[k].raw_data == NULL) return stbi__err("outofmem", "Out of memory");
+         z->img_comp[k].data = (stbi_uc*) (((size_t) z->img_comp[k].raw_data + 15) & ~15);
+      }
+   }
+   #endif
+   p = (stbi__jpeg_stream *) stbi__malloc(sizeof(stbi__jpeg_stream));
+   if (!p) return stbi__err("outofmem", "Out of memory");
+   z->stream = p;
+   p->w = (z->s->img_x + round) >> z->scale_shift;
+   p->h = (z->s->img_y + round) >> z->scale_shift;
+   p->n = z->rows->req_comp ? z->rows->req_comp : z->s->img_n >= 3 ? 3 : 1;
+   p->decode_n = stbi__jpeg_decode_n(z, p->n, &p->is_rgb);
+   p->y = 0;
+   p->unit = 0;
+   p->interleaved = z->scan_n > 1;
+   p->units = p->interleaved ? z->img_mcu_y : (z->img_comp[z->order[0]].y+7) >> 3;
+   p->out = (stbi_uc *) stbi__malloc_mad2(p->n, p->w, 1); // n == 3 writes a fourth byte
+   if (!p->out) return stbi__err("outofmem", "Out of memory");
+   if (!stbi__jpeg_setup_resample(z, p->res_comp, p->decode_n, p->w)) return 0;
+   if (!z->rows->c->size(z->rows->user, p->w, p->h, z->s->img_n >= 3 ? 3 : 1)) return stbi__err("stopped", "Stopped by the row callback");
+   return 1;
+}
+
+// pass on the rows that can be converted once the first units MCU rows are
+// decoded, then drop what's no longer needed. units < 0 finishes the image,
+// even if the scan ended early
+static int stbi__jpeg_stream_rows(stbi__jpeg *z, int units)
+{
+   stbi__jpeg_stream *p = z->stream;
+   int bs = 8 >> z->scale_shift;
+   int k, all = units >= p->units;
+
+   if (units < 0) {
+      // whatever wasn't decoded is left as it is in the window, like it
+      // would be in a whole image
+      for (units = p->unit+1; units <= p->units; ++units)
+         if (!stbi__jpeg_stream_rows(z, units)) return 0;
+      return 1;
+   }
+   p->unit = units;
+
+   while (p->y < p->h) {
+      for (k=0; k < p->decode_n && !all; ++k) {
+         stbi__resample *r = &p->res_comp[k];
+         int need = r->ypos < r->h_lores ? r->ypos : r->h_lores-1;
+         int rows = p->interleaved ? z->img_comp[k].v * bs : bs;
+         if (need >= units * rows) break;
+      }
+      if (k < p->decode_n && !all) break;
+      stbi__jpeg_convert_row(z, p->res_comp, p->out, p->n, p->decode_n, p->is_rgb, p->w);
+      if (!z->rows->c->rows(z->rows->user, p->out, p->y, 1)) return stbi__err("stopped", "Stopped by the row callback");
+      ++p->y;
+   }
+   if (all) return 1;
+
+   for (k=0; k < z->s->img_n; ++k) {
+      int w2 = z->img_comp[k].w2;
+      int rows = p->interleaved ? z->img_comp[k].v * bs : bs;
+      int decoded = units * rows, keep = decoded;
+      int filled = (z->filled > units ? z->filled : units) * rows;
+      if (k < p->decode_n && p->y < p->h) {
+         // upsampling still needs the row above the current one
+         stbi__resample *r = &p->res_comp[k];
+         keep = z->img_comp[k].y0 + (int) ((r->line0 - z->img_comp[k].data) / w2);
+      }
+      if (keep > z->img_comp[k].y0) {
+         int shift = (keep - z->img_comp[k].y0) * w2;
+         memmove(z->img_comp[k].data, z->img_comp[k].data + shift, (filled - keep) * w2);
+         z->img_comp[k].y0 = keep;
+         if (k < p->decode_n) {
+            p->res_comp[k].line0 -= shift;
+            p->res_comp[k].line1 -= shift;
+         }
+      }
+      if (decoded + rows - z->img_comp[k].y0 > z->img_comp[k].h2) return stbi__err("bad window", "Corrupt JPEG");
+   }
+   return 1;
+}
+
 static void *stbi__jpeg_load(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi__result_info *ri)
 {
    unsigned char* result;
    stbi__jpeg* j = (stbi__jpeg*) stbi__malloc(sizeof(stbi__jpeg));
    STBI_NOTUSED(ri);
+   if (!j) return stbi__errpuc("outofmem", "Out of memory");
    j->s = s;
    stbi__setup_jpeg(j);
    result = load_jpeg_image(j, x,y,comp,req_comp);
@@ -3741,10 +4972,31 @@ static void *stbi__jpeg_load(stbi__context *s, int *x, int *y, int *comp, int re
    return result;
 }
 
+static int stbi__jpeg_load_rows(stbi__context *s, stbi__rows *rows)
+{
+   stbi_uc *result;
+   int x = 0, y = 0, comp = 0;
+   stbi__jpeg* j = (stbi__jpeg*) stbi__malloc(sizeof(stbi__jpeg));
+   if (!j) return stbi__err("outofmem", "Out of memory");
+   j->s = s;
+   stbi__setup_jpeg(j);
+   j->rows = rows;
+   result = load_jpeg_image(j, &x, &y, &comp, rows->req_comp);
+   if (j->stream) {
+      STBI_FREE(j->stream->out);
+      STBI_FREE(j->stream);
+   }
+   STBI_FREE(j);
+   if (rows->done) return 1;
+   // progressive, or not in a single scan, so it had to be loaded whole
+   return stbi__rows_whole(rows, result, x, y, comp);
+}
+
 static int stbi__jpeg_test(stbi__context *s)
 {
    int r;
    stbi__jpeg* j = (stbi__jpeg*)stbi__malloc(sizeof(stbi__jpeg));
+   if (!j) return stbi__err("outofmem", "Out of memory");
    j->s = s;
    stbi__setup_jpeg(j);
    r = stbi__decode_jpeg_header(j, STBI__SCAN_type);
@@ -3769,6 +5021,7 @@ static int stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp)
 {
    int result;
    stbi__jpeg* j = (stbi__jpeg*) (stbi__malloc(sizeof(stbi__jpeg)));
+   if (!j) return stbi__err("outofmem", "Out of memory");
    j->s = s;
    result = stbi__jpeg_info_raw(j, x, y, comp);
    STBI_FREE(j);
@@ -3786,7 +5039,8 @@ static int stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp)
 #ifndef STBI_NO_ZLIB
 
 // fast-way is faster to check than jpeg huffman, but slow way is slower
-#define STBI__ZFAST_BITS  9 // accelerate all cases in default tables
+#define STBI__ZFAST_BITS  11 // accelerate all cases in default tables, and
+                             // nearly all in the tables images come with
 #define STBI__ZFAST_MASK  ((1 << STBI__ZFAST_BITS) - 1)
 
 // zlib-style huffman encoding
@@ -3875,29 +5129,68 @@ typedef struct
 {
    stbi_uc *zbuffer, *zbuffer_end;
    int num_bits;
-   stbi__uint32 code_buffer;
+   stbi__uint64 code_buffer; // bits above num_bits may hold the next bytes
 
    char *zout;
    char *zout_start;
    char *zout_end;
    int   z_expandable;
+   int   z_prefix; // only a prefix of the output is wanted, stop once full
+   int   z_full;
+
+   // streaming: zrefill points zbuffer at more input once it runs out, and
+   // returns 0 at the end. zflush is handed the output past zdone whenever
+   // the buffer is full and returns how much of it it consumed, or -1 to
+   // stop. only the window and the unconsumed output are kept after that
+   int (*zrefill)(void *user, stbi_uc **next, stbi_uc **end);
+   int (*zflush)(void *user, stbi_uc *data, int len);
+   void *zuser;
+   int   zdone;
+   int   zpast; // bytes read past the end of a refilled stream
 
    stbi__zhuffman z_length, z_distance;
 } stbi__zbuf;
 
 stbi_inline static stbi_uc stbi__zget8(stbi__zbuf *z)
 {
-   if (z->zbuffer >= z->zbuffer_end) return 0;
+   if (z->zbuffer >= z->zbuffer_end) {
+      if (!z->zrefill) return 0;
+      if (!z->zrefill(z->zuser, &z->zbuffer, &z->zbuffer_end)) { ++z->zpast; return 0; }
+   }
    return *z->zbuffer++;
 }
 
+stbi_inline static stbi__uint64 stbi__zload64(const stbi_uc *p)
+{
+#if defined(STBI__X64_TARGET) || defined(STBI__X86_TARGET) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+   stbi__uint64 v;
+   memcpy(&v, p, 8);
+   return v;
+#else
+   stbi__uint64 v = 0;
+   int i;
+   for (i=7; i >= 0; --i)
+      v = (v << 8) | p[i];
+   return v;
+#endif
+}
+
+// refill to at least 56 bits
 static void stbi__fill_bits(stbi__zbuf *z)
 {
+   if (z->zbuffer_end - z->zbuffer >= 8) {
+      // load 8 bytes at once, and count only the ones that fit whole. the
+      // bits of the next byte that land above num_bits are the same ones
+      // the next refill ORs in, so they can stay
+      z->code_buffer |= stbi__zload64(z->zbuffer) << z->num_bits;
+      z->zbuffer += (63 - z->num_bits) >> 3;
+      z->num_bits |= 56;
+      return;
+   }
    do {
-      STBI_ASSERT(z->code_buffer < (1U << z->num_bits));
-      z->code_buffer |= (unsigned int) stbi__zget8(z) << z->num_bits;
+      z->code_buffer |= (stbi__uint64) stbi__zget8(z) << z->num_bits;
       z->num_bits += 8;
-   } while (z->num_bits <= 24);
+   } while (z->num_bits <= 56);
 }
 
 stbi_inline static unsigned int stbi__zreceive(stbi__zbuf *z, int n)
@@ -3915,7 +5208,7 @@ static int stbi__zhuffman_decode_slowpath(stbi__zbuf *a, stbi__zhuffman *z)
    int b,s,k;
    // not resolved by fast table, so compute it the slow way
    // use jpeg approach, which requires MSbits at top
-   k = stbi__bit_reverse(a->code_buffer, 16);
+   k = stbi__bit_reverse((int) (a->code_buffer & 0xffff), 16);
    for (s=STBI__ZFAST_BITS+1; ; ++s)
       if (k < z->maxcode[s])
          break;
@@ -3942,11 +5235,38 @@ stbi_inline static int stbi__zhuffman_decode(stbi__zbuf *a, stbi__zhuffman *z)
    return stbi__zhuffman_decode_slowpath(a, z);
 }
 
+// the farthest back a match can reach
+#define STBI__ZWINDOW 32768
+
+// flush the output, then move the window and whatever wasn't consumed to the
+// start of the buffer
+static int stbi__zslide(stbi__zbuf *z)
+{
+   char *keep;
+   int done = z->zflush(z->zuser, (stbi_uc *) z->zout_start + z->zdone, (int) (z->zout - z->zout_start) - z->zdone);
+   if (done < 0) return 0;
+   z->zdone += done;
+   keep = z->zout - STBI__ZWINDOW;
+   if (keep > z->zout_start + z->zdone) keep = z->zout_start + z->zdone;
+   if (keep > z->zout_start) {
+      int shift = (int) (keep - z->zout_start);
+      memmove(z->zout_start, keep, z->zout - keep);
+      z->zout  -= shift;
+      z->zdone -= shift;
+   }
+   return 1;
+}
+
 static int stbi__zexpand(stbi__zbuf *z, char *zout, int n)  // need to make room for n bytes
 {
    char *q;
    int cur, limit, old_limit;
    z->zout = zout;
+   if (z->z_prefix) { z->z_full = 1; return 0; }
+   if (z->zflush) {
+      if (!stbi__zslide(z)) return 0;
+      if (z->zout + n <= z->zout_end) return 1;
+   }
    if (!z->z_expandable) return stbi__err("output buffer limit","Corrupt PNG");
    cur   = (int) (z->zout     - z->zout_start);
    limit = old_limit = (int) (z->zout_end - z->zout_start);
@@ -3979,7 +5299,16 @@ static int stbi__parse_huffman_block(stbi__zbuf *a)
 {
    char *zout = a->zout;
    for(;;) {
-      int z = stbi__zhuffman_decode(a, &a->z_length);
+      int z;
+      // one refill covers a length and a distance code with their extra
+      // bits, at most 15+5+15+13 = 48 bits. the bit buffer reads at most 8
+      // bytes ahead, so any more past the end means the data was cut off,
+      // which would otherwise decode zeros forever when streaming
+      if (a->num_bits < 48) {
+         stbi__fill_bits(a);
+         if (a->zpast > 8) return stbi__err("unexpected end","Corrupt PNG");
+      }
+      z = stbi__zhuffman_decode(a, &a->z_length);
       if (z < 256) {
          if (z < 0) return stbi__err("bad huffman code","Corrupt PNG"); // error in huffman codes
          if (zout >= a->zout_end) {
@@ -4008,8 +5337,20 @@ static int stbi__parse_huffman_block(stbi__zbuf *a)
          }
          p = (stbi_uc *) (zout - dist);
          if (dist == 1) { // run of one byte; common in images.
-            stbi_uc v = *p;
-            if (len) { do *zout++ = v; while (--len); }
+            memset(zout, *p, len);
+            zout += len;
+         } else if (dist >= 8 && a->zout_end - zout >= len + 8) {
+            // 8 bytes at a time. the source is at least 8 bytes behind, so
+            // each copy only reads bytes that are already final; it may
+            // write up to 7 bytes past the match, which the next one
+            // overwrites
+            char *end = zout + len;
+            do {
+               memcpy(zout, p, 8);
+               zout += 8;
+               p += 8;
+            } while (zout < end);
+            zout = end;
          } else {
             if (len) { do *zout++ = *p++; while (--len); }
          }
@@ -4074,21 +5415,38 @@ static int stbi__parse_uncompressed_block(stbi__zbuf *a)
       stbi__zreceive(a, a->num_bits & 7); // discard
    // drain the bit-packed data into header
    k = 0;
-   while (a->num_bits > 0) {
+   while (a->num_bits > 0 && k < 4) {
       header[k++] = (stbi_uc) (a->code_buffer & 255); // suppress MSVC run-time check
       a->code_buffer >>= 8;
       a->num_bits -= 8;
    }
-   STBI_ASSERT(a->num_bits == 0);
    // now fill header the normal way
    while (k < 4)
       header[k++] = stbi__zget8(a);
    len  = header[1] * 256 + header[0];
    nlen = header[3] * 256 + header[2];
    if (nlen != (len ^ 0xffff)) return stbi__err("zlib corrupt","Corrupt PNG");
-   if (a->zbuffer + len > a->zbuffer_end) return stbi__err("read past buffer","Corrupt PNG");
    if (a->zout + len > a->zout_end)
       if (!stbi__zexpand(a, a->zout, len)) return 0;
+   // the bit buffer can hold the start of the block, too
+   while (a->num_bits > 0 && len > 0) {
+      *a->zout++ = (char) (a->code_buffer & 255);
+      a->code_buffer >>= 8;
+      a->num_bits -= 8;
+      --len;
+   }
+   // the rest is read straight from the input, so the bits of it that were
+   // loaded ahead have to go
+   if (a->num_bits == 0) a->code_buffer = 0;
+   if (!a->zrefill && a->zbuffer + len > a->zbuffer_end) return stbi__err("read past buffer","Corrupt PNG");
+   while (a->zbuffer + len > a->zbuffer_end) {
+      // the block goes on in the next piece of input
+      int k = (int) (a->zbuffer_end - a->zbuffer);
+      memcpy(a->zout, a->zbuffer, k);
+      a->zout += k;
+      len -= k;
+      if (!a->zrefill(a->zuser, &a->zbuffer, &a->zbuffer_end)) return stbi__err("read past buffer","Corrupt PNG");
+   }
    memcpy(a->zout, a->zbuffer, len);
    a->zbuffer += len;
    a->zout += len;
@@ -4144,6 +5502,7 @@ static int stbi__parse_zlib(stbi__zbuf *a, int parse_header)
       if (!stbi__parse_zlib_header(a)) return 0;
    a->num_bits = 0;
    a->code_buffer = 0;
+   a->zpast = 0;
    do {
       final = stbi__zreceive(a,1);
       type = stbi__zreceive(a,2);
@@ -4171,10 +5530,47 @@ static int stbi__do_zlib(stbi__zbuf *a, char *obuf, int olen, int exp, int parse
    a->zout       = obuf;
    a->zout_end   = obuf + olen;
    a->z_expandable = exp;
+   a->z_prefix   = 0;
+   a->z_full     = 0;
+   a->zrefill    = NULL;
+   a->zflush     = NULL;
 
    return stbi__parse_zlib(a, parse_header);
 }
 
+// room past the prefix: more than a stored block (at most 65535 bytes) and
+// far more than a huffman block's longest match (258 bytes)
+#define STBI__ZPREFIX_SLACK 65536
+
+// decode at least the first prefix_len bytes (unless the data ends sooner).
+// decoding stops at the first stored block, literal or match that doesn't
+// fit, which may be in the middle of a huffman block. a stored block that
+// starts within the prefix always fits, and a literal or match only misses
+// the last 258 bytes of the buffer, so the stop is always past prefix_len
+static char *stbi__zlib_decode_prefix(const char *buffer, int len, int prefix_len, int *outlen, int parse_header)
+{
+   stbi__zbuf a;
+   char *p = (char *) stbi__malloc_mad2(1, prefix_len, STBI__ZPREFIX_SLACK);
+   if (p == NULL) return NULL;
+   a.zbuffer = (stbi_uc *) buffer;
+   a.zbuffer_end = (stbi_uc *) buffer + len;
+   a.zout_start = p;
+   a.zout       = p;
+   a.zout_end   = p + prefix_len + STBI__ZPREFIX_SLACK;
+   a.z_expandable = 0;
+   a.z_prefix   = 1;
+   a.z_full     = 0;
+   a.zrefill    = NULL;
+   a.zflush     = NULL;
+   if (stbi__parse_zlib(&a, parse_header) || a.z_full) {
+      if (outlen) *outlen = (int) (a.zout - a.zout_start);
+      return a.zout_start;
+   } else {
+      STBI_FREE(a.zout_start);
+      return NULL;
+   }
+}
+
 STBIDEF char *stbi_zlib_decode_malloc_guesssize(const char *buffer, int len, int initial_size, int *outlen)
 {
    stbi__zbuf a;
@@ -4290,6 +5686,9 @@ typedef struct
    stbi__context *s;
    stbi_uc *idata, *expanded, *out;
    int depth;
+   int passes;        // Adam7 passes loaded whole, 7 if CgBI, 0 if passed on row by row
+   stbi__rows *rows;  // pass rows on as they're decoded, if not NULL
+   stbi_uc *prior;    // if not NULL, the unfiltered row before the ones being created
 } stbi__png;
 
 
@@ -4324,6 +5723,128 @@ static int stbi__paeth(int a, int b, int c)
    return c;
 }
 
+#ifdef STBI_SSE2
+// moves one pixel of n bytes, n being 3 or 4. 3-byte pixels are moved in two
+// pieces, so nothing past the end of a row is touched
+stbi_inline static __m128i stbi__png_load_pixel(const stbi_uc *p, int n)
+{
+   stbi__uint32 v;
+   if (n == 4) {
+      memcpy(&v, p, 4);
+   } else {
+      stbi__uint16 lo;
+      memcpy(&lo, p, 2);
+      v = lo | ((stbi__uint32) p[2] << 16);
+   }
+   return _mm_cvtsi32_si128((int) v);
+}
+
+stbi_inline static void stbi__png_store_pixel(stbi_uc *p, __m128i v, int n)
+{
+   stbi__uint32 u = (stbi__uint32) _mm_cvtsi128_si32(v);
+   if (n == 4) {
+      memcpy(p, &u, 4);
+   } else {
+      stbi__uint16 lo = (stbi__uint16) u;
+      memcpy(p, &lo, 2);
+      p[2] = (stbi_uc) (u >> 16);
+   }
+}
+
+// undoes the filter of one row of x 8-bit pixels of img_n channels (3 or 4),
+// stored as out_n channels with an opaque alpha added if out_n is larger.
+// every filter but 'up' depends on the pixel to the left, so this goes a
+// pixel at a time, with all of its channels in one register
+static void stbi__png_unfilter_row_sse2(stbi_uc *cur, stbi_uc *raw, stbi_uc *prior, int filter, int img_n, int out_n, stbi__uint32 x)
+{
+   __m128i zero = _mm_setzero_si128();
+   __m128i alpha = _mm_cvtsi32_si128(img_n == out_n ? 0 : (int) 0xff000000u);
+   __m128i a = zero; // the pixel to the left
+   stbi__uint32 i;
+
+   if ((filter == STBI__F_none || filter == STBI__F_up) && img_n == out_n) {
+      stbi__uint32 n = x*img_n, k = 0;
+      if (filter == STBI__F_none) {
+         memcpy(cur, raw, n);
+         return;
+      }
+      for (; k+16 <= n; k += 16) {
+         __m128i r = _mm_loadu_si128((__m128i *) (raw + k));
+         __m128i b = _mm_loadu_si128((__m128i *) (prior + k));
+         _mm_storeu_si128((__m128i *) (cur + k), _mm_add_epi8(r, b));
+      }
+      for (; k < n; ++k)
+         cur[k] = STBI__BYTECAST(raw[k] + prior[k]);
+      return;
+   }
+
+   switch (filter) {
+      case STBI__F_none:
+         for (i=0; i < x; ++i, raw += img_n, cur += out_n)
+            stbi__png_store_pixel(cur, _mm_or_si128(stbi__png_load_pixel(raw, img_n), alpha), out_n);
+         break;
+      case STBI__F_up:
+         for (i=0; i < x; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            a = _mm_add_epi8(stbi__png_load_pixel(raw, img_n), stbi__png_load_pixel(prior, out_n));
+            stbi__png_store_pixel(cur, _mm_or_si128(a, alpha), out_n);
+         }
+         break;
+      case STBI__F_sub:
+      case STBI__F_paeth_first: // the left pixel is always closest
+         for (i=0; i < x; ++i, raw += img_n, cur += out_n) {
+            a = _mm_add_epi8(stbi__png_load_pixel(raw, img_n), a);
+            stbi__png_store_pixel(cur, _mm_or_si128(a, alpha), out_n);
+         }
+         break;
+      case STBI__F_avg: {
+         // pavgb rounds up, so take back the carry of odd sums
+         __m128i one = _mm_set1_epi8(1);
+         for (i=0; i < x; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            __m128i b = stbi__png_load_pixel(prior, out_n);
+            __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+            a = _mm_add_epi8(stbi__png_load_pixel(raw, img_n), avg);
+            stbi__png_store_pixel(cur, _mm_or_si128(a, alpha), out_n);
+         }
+         break;
+      }
+      case STBI__F_avg_first: {
+         __m128i low7 = _mm_set1_epi8(0x7f);
+         for (i=0; i < x; ++i, raw += img_n, cur += out_n) {
+            __m128i half = _mm_and_si128(_mm_srli_epi16(a, 1), low7);
+            a = _mm_add_epi8(stbi__png_load_pixel(raw, img_n), half);
+            stbi__png_store_pixel(cur, _mm_or_si128(a, alpha), out_n);
+         }
+         break;
+      }
+      case STBI__F_paeth: {
+         // in 16 bits per channel: with p = a+b-c, |p-a| = |b-c|,
+         // |p-b| = |a-c| and |p-c| = |(b-c) + (a-c)|. ties go to a, then b
+         __m128i c = zero; // the pixel above and to the left
+         for (i=0; i < x; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            __m128i b = _mm_unpacklo_epi8(stbi__png_load_pixel(prior, out_n), zero);
+            __m128i pa = _mm_sub_epi16(b, c);
+            __m128i pb = _mm_sub_epi16(a, c);
+            __m128i pc = _mm_add_epi16(pa, pb);
+            __m128i smallest, pred, r;
+            pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+            pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+            pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+            smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+            pred = _mm_cmpeq_epi16(pb, smallest);
+            pred = _mm_or_si128(_mm_and_si128(pred, b), _mm_andnot_si128(pred, c));
+            r = _mm_cmpeq_epi16(pa, smallest);
+            pred = _mm_or_si128(_mm_and_si128(r, a), _mm_andnot_si128(r, pred));
+            r = _mm_add_epi8(stbi__png_load_pixel(raw, img_n), _mm_packus_epi16(pred, pred));
+            stbi__png_store_pixel(cur, _mm_or_si128(r, alpha), out_n);
+            a = _mm_unpacklo_epi8(r, zero);
+            c = b;
+         }
+         break;
+      }
+   }
+}
+#endif
+
 static const stbi_uc stbi__depth_scale_table[9] = { 0, 0xff, 0x55, 0, 0x11, 0,0,0, 0x01 };
 
 // create the png data from post-deflated data
@@ -4335,6 +5856,9 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
    stbi__uint32 img_len, img_width_bytes;
    int k;
    int img_n = s->img_n; // copy it into a local for later
+#ifdef STBI_SSE2
+   int simd = depth == 8 && (img_n == 3 || img_n == 4) && stbi__sse2_available();
+#endif
 
    int output_bytes = out_n*bytes;
    int filter_bytes = img_n*bytes;
@@ -4370,7 +5894,18 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
       prior = cur - stride; // bugfix: need to compute this after 'cur +=' computation above
 
       // if first row, use special filter that doesn't sample previous row
-      if (j == 0) filter = first_row_filter[filter];
+      if (j == 0) {
+         if (a->prior) prior = a->prior + (cur - a->out);
+         else filter = first_row_filter[filter];
+      }
+
+#ifdef STBI_SSE2
+      if (simd) {
+         stbi__png_unfilter_row_sse2(cur, raw, prior, filter, img_n, out_n, x);
+         raw += img_n*x;
+         continue;
+      }
+#endif
 
       // handle first byte explicitly
       for (k=0; k < filter_bytes; ++k) {
@@ -4451,6 +5986,10 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
       }
    }
 
+   // the next rows filter against the last one, as it is before the passes below
+   if (a->prior)
+      memcpy(a->prior, a->out + stride*(y-1), stride);
+
    // we make a separate pass to expand bits to pixels; for performance,
    // this could run two scanlines behind the above code, so it won't
    // intefere with filtering but will still be in the cache.
@@ -4539,37 +6078,75 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
    return 1;
 }
 
-static int stbi__create_png_image(stbi__png *a, stbi_uc *image_data, stbi__uint32 image_data_len, int out_n, int depth, int color, int interlaced)
+// Adam7 pass origins and spacing
+static const int stbi__adam7_xorig[7] = { 0,4,0,2,0,1,0 };
+static const int stbi__adam7_yorig[7] = { 0,0,4,0,2,0,1 };
+static const int stbi__adam7_xspc[7]  = { 8,8,4,4,2,2,1 };
+static const int stbi__adam7_yspc[7]  = { 8,8,8,4,4,2,2 };
+
+// the pixels of the first p+1 passes together form a grid with this spacing
+static const int stbi__adam7_xgrid[7] = { 8,4,4,2,2,1,1 };
+static const int stbi__adam7_ygrid[7] = { 8,8,4,4,2,2,1 };
+
+// the number of Adam7 passes needed to meet stbi_set_min_size_on_load()
+static int stbi__png_adam7_passes(stbi__uint32 img_x, stbi__uint32 img_y)
+{
+   int p;
+   if (stbi__min_load_x <= 0 && stbi__min_load_y <= 0) return 7;
+   for (p=0; p < 6; ++p) {
+      stbi__uint32 x = (img_x + stbi__adam7_xgrid[p]-1) / stbi__adam7_xgrid[p];
+      stbi__uint32 y = (img_y + stbi__adam7_ygrid[p]-1) / stbi__adam7_ygrid[p];
+      if ((int) x >= stbi__min_load_x && (int) y >= stbi__min_load_y) break;
+   }
+   return p+1;
+}
+
+// the filtered size of Adam7 pass p
+static stbi__uint32 stbi__png_adam7_len(stbi__context *s, int p, int depth, stbi__uint32 *px, stbi__uint32 *py)
+{
+   // pass1_x[4] = 0, pass1_x[5] = 1, pass1_x[12] = 1
+   stbi__uint32 x = (s->img_x - stbi__adam7_xorig[p] + stbi__adam7_xspc[p]-1) / stbi__adam7_xspc[p];
+   stbi__uint32 y = (s->img_y - stbi__adam7_yorig[p] + stbi__adam7_yspc[p]-1) / stbi__adam7_yspc[p];
+   if (px) *px = x;
+   if (py) *py = y;
+   if (!x || !y) return 0;
+   return ((((s->img_n * x * depth) + 7) >> 3) + 1) * y;
+}
+
+// only the first 'passes' passes of an interlaced image are decoded, and the
+// image shrinks to the grid they fill
+static int stbi__create_png_image(stbi__png *a, stbi_uc *image_data, stbi__uint32 image_data_len, int out_n, int depth, int color, int interlaced, int passes)
 {
    int bytes = (depth == 16 ? 2 : 1);
    int out_bytes = out_n * bytes;
    stbi_uc *final;
+   stbi__uint32 final_x, final_y;
    int p;
    if (!interlaced)
       return stbi__create_png_image_raw(a, image_data, image_data_len, out_n, a->s->img_x, a->s->img_y, depth, color);
 
    // de-interlacing
-   final = (stbi_uc *) stbi__malloc_mad3(a->s->img_x, a->s->img_y, out_bytes, 0);
-   for (p=0; p < 7; ++p) {
-      int xorig[] = { 0,4,0,2,0,1,0 };
-      int yorig[] = { 0,0,4,0,2,0,1 };
-      int xspc[]  = { 8,8,4,4,2,2,1 };
-      int yspc[]  = { 8,8,8,4,4,2,2 };
-      int i,j,x,y;
-      // pass1_x[4] = 0, pass1_x[5] = 1, pass1_x[12] = 1
-      x = (a->s->img_x - xorig[p] + xspc[p]-1) / xspc[p];
-      y = (a->s->img_y - yorig[p] + yspc[p]-1) / yspc[p];
-      if (x && y) {
-         stbi__uint32 img_len = ((((a->s->img_n * x * depth) + 7) >> 3) + 1) * y;
+   final_x = (a->s->img_x + stbi__adam7_xgrid[passes-1]-1) / stbi__adam7_xgrid[passes-1];
+   final_y = (a->s->img_y + stbi__adam7_ygrid[passes-1]-1) / stbi__adam7_ygrid[passes-1];
+   final = (stbi_uc *) stbi__malloc_mad3(final_x, final_y, out_bytes, 0);
+   if (!final) return stbi__err("outofmem", "Out of memory");
+   for (p=0; p < passes; ++p) {
+      int xspc = stbi__adam7_xspc[p] / stbi__adam7_xgrid[passes-1];
+      int yspc = stbi__adam7_yspc[p] / stbi__adam7_ygrid[passes-1];
+      int xorig = stbi__adam7_xorig[p] / stbi__adam7_xgrid[passes-1];
+      int yorig = stbi__adam7_yorig[p] / stbi__adam7_ygrid[passes-1];
+      stbi__uint32 i,j,x,y;
+      stbi__uint32 img_len = stbi__png_adam7_len(a->s, p, depth, &x, &y);
+      if (img_len) {
          if (!stbi__create_png_image_raw(a, image_data, image_data_len, out_n, x, y, depth, color)) {
             STBI_FREE(final);
             return 0;
          }
          for (j=0; j < y; ++j) {
             for (i=0; i < x; ++i) {
-               int out_y = j*yspc[p]+yorig[p];
-               int out_x = i*xspc[p]+xorig[p];
-               memcpy(final + out_y*a->s->img_x*out_bytes + out_x*out_bytes,
+               int out_y = j*yspc+yorig;
+               int out_x = i*xspc+xorig;
+               memcpy(final + out_y*final_x*out_bytes + out_x*out_bytes,
                       a->out + (j*x+i)*out_bytes, out_bytes);
             }
          }
@@ -4579,6 +6156,8 @@ static int stbi__create_png_image(stbi__png *a, stbi_uc *image_data, stbi__uint3
       }
    }
    a->out = final;
+   a->s->img_x = final_x;
+   a->s->img_y = final_y;
 
    return 1;
 }
@@ -4670,19 +6249,46 @@ static int stbi__expand_png_palette(stbi__png *a, stbi_uc *palette, int len, int
    return 1;
 }
 
-static int stbi__unpremultiply_on_load = 0;
-static int stbi__de_iphone_flag = 0;
+static int stbi__unpremultiply_on_load_global = 0;
+static int stbi__de_iphone_flag_global = 0;
 
 STBIDEF void stbi_set_unpremultiply_on_load(int flag_true_if_should_unpremultiply)
 {
-   stbi__unpremultiply_on_load = flag_true_if_should_unpremultiply;
+   stbi__unpremultiply_on_load_global = flag_true_if_should_unpremultiply;
 }
 
 STBIDEF void stbi_convert_iphone_png_to_rgb(int flag_true_if_should_convert)
 {
-   stbi__de_iphone_flag = flag_true_if_should_convert;
+   stbi__de_iphone_flag_global = flag_true_if_should_convert;
+}
+
+#ifndef STBI_THREAD_LOCAL
+#define stbi__unpremultiply_on_load  stbi__unpremultiply_on_load_global
+#define stbi__de_iphone_flag  stbi__de_iphone_flag_global
+#else
+static STBI_THREAD_LOCAL int stbi__unpremultiply_on_load_local, stbi__unpremultiply_on_load_set;
+static STBI_THREAD_LOCAL int stbi__de_iphone_flag_local, stbi__de_iphone_flag_set;
+
+STBIDEF void stbi_set_unpremultiply_on_load_thread(int flag_true_if_should_unpremultiply)
+{
+   stbi__unpremultiply_on_load_local = flag_true_if_should_unpremultiply;
+   stbi__unpremultiply_on_load_set = 1;
 }
 
+STBIDEF void stbi_convert_iphone_png_to_rgb_thread(int flag_true_if_should_convert)
+{
+   stbi__de_iphone_flag_local = flag_true_if_should_convert;
+   stbi__de_iphone_flag_set = 1;
+}
+
+#define stbi__unpremultiply_on_load  (stbi__unpremultiply_on_load_set           \
+                                       ? stbi__unpremultiply_on_load_local      \
+                                       : stbi__unpremultiply_on_load_global)
+#define stbi__de_iphone_flag  (stbi__de_iphone_flag_set                         \
+                                ? stbi__de_iphone_flag_local                    \
+                                : stbi__de_iphone_flag_global)
+#endif // STBI_THREAD_LOCAL
+
 static void stbi__de_iphone(stbi__png *z)
 {
    stbi__context *s = z->s;
@@ -4728,25 +6334,355 @@ static void stbi__de_iphone(stbi__png *z)
 
 #define STBI__PNG_TYPE(a,b,c,d)  (((unsigned) (a) << 24) + ((unsigned) (b) << 16) + ((unsigned) (c) << 8) + (unsigned) (d))
 
+// non-interlaced images can be passed on row by row: the IDATs are read as
+// the inflater needs them, and rows are unfiltered and converted whenever its
+// buffer fills up. the chunk after the last IDAT ends up in 'next'
+#define STBI__PNG_STREAM_IN 65536
+
+typedef struct
+{
+   stbi__png *z;
+   stbi__uint32 left;    // bytes left in the current IDAT
+   int ended;            // past the IDATs
+   stbi__pngchunk next;
+   stbi_uc *in;
+   stbi__uint32 y;       // next row
+   stbi__uint32 row_len; // filtered bytes per row
+   int color, out_n, final_n, req_comp;
+   int has_trans;
+   stbi_uc *tc;
+   stbi__uint16 *tc16;
+   stbi_uc *palette;
+   int pal_len, pal_img_n;
+} stbi__png_stream;
+
+static int stbi__png_refill(void *user, stbi_uc **next, stbi_uc **end)
+{
+   stbi__png_stream *p = (stbi__png_stream *) user;
+   stbi__context *s = p->z->s;
+   stbi__uint32 n;
+   while (p->left == 0) {
+      if (p->ended) return 0;
+      stbi__get32be(s); // CRC of the previous IDAT
+      p->next = stbi__get_chunk_header(s);
+      if (p->next.type != STBI__PNG_TYPE('I','D','A','T')) {
+         p->ended = 1;
+         return 0;
+      }
+      p->left = p->next.length;
+   }
+   n = p->left < STBI__PNG_STREAM_IN ? p->left : STBI__PNG_STREAM_IN;
+   if (!stbi__getn(s, p->in, n)) {
+      p->ended = 1;
+      return 0;
+   }
+   p->left -= n;
+   *next = p->in;
+   *end = p->in + n;
+   return 1;
+}
+
+// unfilter, expand and convert n rows the same way a whole image would be
+static int stbi__png_stream_rows(stbi__png_stream *p, stbi_uc *raw, stbi__uint32 n)
+{
+   stbi__png *z = p->z;
+   stbi__context *s = z->s;
+   void *result;
+   int channels = p->final_n, ok;
+   if (!stbi__create_png_image_raw(z, raw, n*p->row_len, p->out_n, s->img_x, n, z->depth, p->color)) return 0;
+   if (p->has_trans) {
+      if (z->depth == 16) stbi__compute_transparency16(z, p->tc16, p->out_n);
+      else stbi__compute_transparency(z, p->tc, p->out_n);
+   }
+   if (p->pal_img_n && !stbi__expand_png_palette(z, p->palette, p->pal_len, p->final_n)) return 0;
+   result = z->out;
+   z->out = NULL;
+   if (p->req_comp && p->req_comp != channels) {
+      if (z->depth == 16)
+         result = stbi__convert_format16((stbi__uint16 *) result, channels, p->req_comp, s->img_x, n);
+      else
+         result = stbi__convert_format((unsigned char *) result, channels, p->req_comp, s->img_x, n);
+      if (result == NULL) return 0;
+      channels = p->req_comp;
+   }
+   if (z->depth == 16) {
+      result = stbi__convert_16_to_8((stbi__uint16 *) result, s->img_x, n, channels);
+      if (result == NULL) return 0;
+   }
+   ok = z->rows->c->rows(z->rows->user, (stbi_uc *) result, p->y, n);
+   STBI_FREE(result);
+   if (!ok) return stbi__err("stopped", "Stopped by the row callback");
+   return 1;
+}
+
+static int stbi__png_flush(void *user, stbi_uc *data, int len)
+{
+   stbi__png_stream *p = (stbi__png_stream *) user;
+   stbi__context *s = p->z->s;
+   stbi__uint32 img_y = s->img_y;
+   stbi__uint32 n = len / p->row_len;
+   int ok;
+   // anything past the last row is ignored, like in a whole image
+   if (n > img_y - p->y) n = img_y - p->y;
+   if (n == 0) return p->y == img_y ? len : 0;
+   // the helpers work on all of img_y, so make it the rows at hand
+   s->img_y = n;
+   ok = stbi__png_stream_rows(p, data, n);
+   s->img_y = img_y;
+   if (!ok) return -1;
+   p->y += n;
+   return (int) (n * p->row_len);
+}
+
+// inflates the IDATs into rows for flush, and leaves the stream at the chunk
+// after them
+static int stbi__png_inflate_rows(stbi__png_stream *p, int (*refill)(void *, stbi_uc **, stbi_uc **), int (*flush)(void *, stbi_uc *, int), void *user)
+{
+   stbi__context *s = p->z->s;
+   stbi__zbuf a;
+   stbi_uc *dummy;
+   int ok;
+   int out_len = STBI__ZWINDOW + p->row_len + 65536;
+
+   a.zout_start = (char *) stbi__malloc(out_len);
+   if (!a.zout_start) return stbi__err("outofmem", "Out of memory");
+   a.zbuffer = a.zbuffer_end = p->in;
+   a.zout = a.zout_start;
+   a.zout_end = a.zout_start + out_len;
+   a.z_expandable = 1;
+   a.z_prefix = 0;
+   a.z_full = 0;
+   a.zrefill = refill;
+   a.zflush = flush;
+   a.zuser = user;
+   a.zdone = 0;
+   ok = stbi__parse_zlib(&a, 1) && stbi__zslide(&a);
+   if (ok && p->y < s->img_y) ok = stbi__err("not enough pixels","Corrupt PNG");
+   // skip the rest of the IDATs, up to the chunk after them
+   while (ok && !p->ended) {
+      stbi__skip(s, p->left);
+      p->left = 0;
+      stbi__png_refill(p, &dummy, &dummy);
+   }
+   STBI_FREE(a.zout_start);
+   return ok;
+}
+
+#ifdef STBI_THREADS
+// a second thread inflates while this one unfilters, converts and passes on
+// the rows. the inflated rows go through a ring of a few of them, so neither
+// thread waits for the other unless it is ahead by a full ring
+#define STBI__PNG_PIPE_SIZE  (256*1024)  // ring size in bytes, rounded to rows
+#define STBI__PNG_PIPE_MIN   (1024*1024) // smaller images aren't worth a thread
+
+typedef struct
+{
+   stbi__png_stream *p;
+   stbi_uc *ring;
+   stbi__uint32 size;      // rows that fit in the ring
+   stbi__uint32 in, out;   // rows put into and taken out of it so far
+   int done, ok, stop;
+   const char *failure;    // the inflating thread's failure reason
+   stbi__mutex mutex;
+   stbi__cond cond;        // signaled whenever any of the above changes
+} stbi__png_pipe;
+
+static int stbi__png_pipe_refill(void *user, stbi_uc **next, stbi_uc **end)
+{
+   return stbi__png_refill(((stbi__png_pipe *) user)->p, next, end);
+}
+
+// copies whole rows into the ring, waiting for room as needed
+static int stbi__png_pipe_flush(void *user, stbi_uc *data, int len)
+{
+   stbi__png_pipe *q = (stbi__png_pipe *) user;
+   stbi__png_stream *p = q->p;
+   stbi__uint32 img_y = p->z->s->img_y;
+   stbi__uint32 n = len / p->row_len, left;
+   // anything past the last row is ignored, like in a whole image
+   if (n > img_y - p->y) n = img_y - p->y;
+   if (n == 0) return p->y == img_y ? len : 0;
+   for (left = n; left > 0; ) {
+      stbi__uint32 k, at;
+      int stop;
+      stbi__mutex_lock(&q->mutex);
+      while (q->in - q->out == q->size && !q->stop)
+         stbi__cond_wait(&q->cond, &q->mutex);
+      k = q->size - (q->in - q->out);
+      stop = q->stop;
+      stbi__mutex_unlock(&q->mutex);
+      if (stop) return -1;
+      at = q->in % q->size;
+      if (k > q->size - at) k = q->size - at;
+      if (k > left) k = left;
+      memcpy(q->ring + at * p->row_len, data, k * p->row_len);
+      data += k * p->row_len;
+      left -= k;
+      stbi__mutex_lock(&q->mutex);
+      q->in += k;
+      stbi__cond_broadcast(&q->cond);
+      stbi__mutex_unlock(&q->mutex);
+   }
+   p->y += n;
+   return (int) (n * p->row_len);
+}
+
+STBI__THREAD_PROC(stbi__png_pipe_inflate, arg)
+{
+   stbi__png_pipe *q = (stbi__png_pipe *) arg;
+   int ok = stbi__png_inflate_rows(q->p, stbi__png_pipe_refill, stbi__png_pipe_flush, q);
+   stbi__mutex_lock(&q->mutex);
+   q->ok = ok;
+   q->failure = stbi__g_failure_reason;
+   q->done = 1;
+   stbi__cond_broadcast(&q->cond);
+   stbi__mutex_unlock(&q->mutex);
+   STBI__THREAD_RETURN;
+}
+
+// returns -1 if the thread couldn't be started, to do it all on this one
+static int stbi__png_pipe_rows(stbi__png_stream *p)
+{
+   stbi__png_pipe q;
+   stbi__thread thread;
+   // this thread's own copies, as the other one keeps using p and its context
+   stbi__png_stream cp = *p;
+   stbi__png cz = *p->z;
+   stbi__context cs = *p->z->s;
+   int ok = 1;
+
+   cz.s = &cs;
+   cp.z = &cz;
+   q.p = p;
+   q.size = STBI__PNG_PIPE_SIZE / p->row_len;
+   if (q.size < 2) q.size = 2;
+   q.in = q.out = 0;
+   q.done = q.ok = q.stop = 0;
+   q.failure = NULL;
+   q.ring = (stbi_uc *) stbi__malloc_mad2(q.size, p->row_len, 0);
+   if (!q.ring) return -1;
+   if (!stbi__mutex_init(&q.mutex)) {
+      STBI_FREE(q.ring);
+      return -1;
+   }
+   if (!stbi__cond_init(&q.cond)) {
+      stbi__mutex_destroy(&q.mutex);
+      STBI_FREE(q.ring);
+      return -1;
+   }
+   if (!stbi__thread_create(&thread, stbi__png_pipe_inflate, &q)) {
+      stbi__cond_destroy(&q.cond);
+      stbi__mutex_destroy(&q.mutex);
+      STBI_FREE(q.ring);
+      return -1;
+   }
+
+   for (;;) {
+      stbi__uint32 n, at;
+      stbi__mutex_lock(&q.mutex);
+      while (q.in == q.out && !q.done)
+         stbi__cond_wait(&q.cond, &q.mutex);
+      n = q.in - q.out;
+      stbi__mutex_unlock(&q.mutex);
+      if (n == 0) break;
+      at = q.out % q.size;
+      if (n > q.size - at) n = q.size - at;
+      cs.img_y = n; // the helpers work on all of img_y
+      if (!stbi__png_stream_rows(&cp, q.ring + at * p->row_len, n)) {
+         stbi__mutex_lock(&q.mutex);
+         q.stop = 1;
+         stbi__cond_broadcast(&q.cond);
+         stbi__mutex_unlock(&q.mutex);
+         ok = 0;
+         break;
+      }
+      cp.y += n;
+      stbi__mutex_lock(&q.mutex);
+      q.out += n;
+      stbi__cond_broadcast(&q.cond);
+      stbi__mutex_unlock(&q.mutex);
+   }
+
+   stbi__thread_join(thread);
+   if (ok && !q.ok) {
+      stbi__g_failure_reason = q.failure;
+      ok = 0;
+   }
+   p->z->out = cz.out; // left over if unfiltering failed
+   stbi__cond_destroy(&q.cond);
+   stbi__mutex_destroy(&q.mutex);
+   STBI_FREE(q.ring);
+   return ok;
+}
+#endif
+
+static int stbi__png_stream_idat(stbi__png_stream *p, stbi__uint32 len)
+{
+   stbi__png *z = p->z;
+   stbi__context *s = z->s;
+   int comp, ok;
+   int bytes = z->depth == 16 ? 2 : 1;
+
+   if ((p->req_comp == s->img_n+1 && p->req_comp != 3 && !p->pal_img_n) || p->has_trans)
+      p->out_n = s->img_n+1;
+   else
+      p->out_n = s->img_n;
+   p->final_n = p->out_n;
+   comp = s->img_n + (p->has_trans ? 1 : 0);
+   if (p->pal_img_n) {
+      p->final_n = p->req_comp >= 3 ? p->req_comp : p->pal_img_n;
+      comp = p->pal_img_n;
+   }
+   if (!stbi__mad3sizes_valid(s->img_n, s->img_x, z->depth, 7)) return stbi__err("too large", "Corrupt PNG");
+   p->row_len = ((s->img_n * s->img_x * z->depth + 7) >> 3) + 1;
+   p->left = len;
+   p->ended = 0;
+   p->y = 0;
+   if (!z->rows->c->size(z->rows->user, s->img_x, s->img_y, comp)) return stbi__err("stopped", "Stopped by the row callback");
+
+   z->prior = (stbi_uc *) stbi__malloc_mad3(s->img_x, p->out_n, bytes, 0);
+   p->in = (stbi_uc *) stbi__malloc(STBI__PNG_STREAM_IN);
+   ok = z->prior && p->in;
+   if (ok) {
+      memset(z->prior, 0, s->img_x * p->out_n * bytes); // same as no prior row
+      ok = -1;
+      #ifdef STBI_THREADS
+      if ((stbi__uint64) p->row_len * s->img_y >= STBI__PNG_PIPE_MIN && stbi__load_threads() > 1)
+         ok = stbi__png_pipe_rows(p);
+      #endif
+      if (ok < 0)
+         ok = stbi__png_inflate_rows(p, stbi__png_refill, stbi__png_flush, p);
+   } else stbi__err("outofmem", "Out of memory");
+   STBI_FREE(z->prior); z->prior = NULL;
+   STBI_FREE(p->in);
+   if (ok) z->rows->done = 1;
+   return ok;
+}
+
 static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
 {
    stbi_uc palette[1024], pal_img_n=0;
    stbi_uc has_trans=0, tc[3];
    stbi__uint16 tc16[3];
    stbi__uint32 ioff=0, idata_limit=0, i, pal_len=0;
-   int first=1,k,interlace=0, color=0, is_iphone=0;
+   int first=1,k,interlace=0, color=0, is_iphone=0, streamed=0;
    stbi__context *s = z->s;
+   stbi__pngchunk next;
 
    z->expanded = NULL;
    z->idata = NULL;
    z->out = NULL;
+   z->prior = NULL;
+   next.type = 0;
 
    if (!stbi__check_png_header(s)) return 0;
 
    if (scan == STBI__SCAN_type) return 1;
 
    for (;;) {
-      stbi__pngchunk c = stbi__get_chunk_header(s);
+      // after streaming, the header of the next chunk has been read already
+      stbi__pngchunk c = next.type ? next : stbi__get_chunk_header(s);
+      next.type = 0;
       switch (c.type) {
          case STBI__PNG_TYPE('C','g','B','I'):
             is_iphone = 1;
@@ -4766,6 +6702,7 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
             comp  = stbi__get8(s);  if (comp) return stbi__err("bad comp method","Corrupt PNG");
             filter= stbi__get8(s);  if (filter) return stbi__err("bad filter method","Corrupt PNG");
             interlace = stbi__get8(s); if (interlace>1) return stbi__err("bad interlace method","Corrupt PNG");
+            z->passes = interlace ? stbi__png_adam7_passes(s->img_x, s->img_y) : is_iphone ? 7 : 0;
             if (!s->img_x || !s->img_y) return stbi__err("0-pixel image","Corrupt PNG");
             if (!pal_img_n) {
                s->img_n = (color & 2 ? 3 : 1) + (color & 4 ? 1 : 0);
@@ -4822,6 +6759,22 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
             if (first) return stbi__err("first not IHDR", "Corrupt PNG");
             if (pal_img_n && !pal_len) return stbi__err("no PLTE","Corrupt PNG");
             if (scan == STBI__SCAN_header) { s->img_n = pal_img_n; return 1; }
+            if (z->rows && !interlace && !is_iphone && !streamed && !z->idata) {
+               stbi__png_stream p;
+               p.z = z;
+               p.req_comp = req_comp;
+               p.color = color;
+               p.has_trans = has_trans;
+               p.tc = tc;
+               p.tc16 = tc16;
+               p.palette = palette;
+               p.pal_len = pal_len;
+               p.pal_img_n = pal_img_n;
+               if (!stbi__png_stream_idat(&p, c.length)) return 0;
+               streamed = 1;
+               next = p.next;
+               continue;
+            }
             if ((int)(ioff + c.length) < (int)ioff) return 0;
             if (ioff + c.length > idata_limit) {
                stbi__uint32 idata_limit_old = idata_limit;
@@ -4840,20 +6793,31 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
 
          case STBI__PNG_TYPE('I','E','N','D'): {
             stbi__uint32 raw_len, bpl;
+            int passes = 7;
             if (first) return stbi__err("first not IHDR", "Corrupt PNG");
             if (scan != STBI__SCAN_load) return 1;
+            if (streamed) return 1;
             if (z->idata == NULL) return stbi__err("no IDAT","Corrupt PNG");
-            // initial guess for decoded data size to avoid unnecessary reallocs
-            bpl = (s->img_x * z->depth + 7) / 8; // bytes per line, per component
-            raw_len = bpl * s->img_y * s->img_n /* pixels */ + s->img_y /* filter mode per row */;
-            z->expanded = (stbi_uc *) stbi_zlib_decode_malloc_guesssize_headerflag((char *) z->idata, ioff, raw_len, (int *) &raw_len, !is_iphone);
+            if (interlace) passes = stbi__png_adam7_passes(s->img_x, s->img_y);
+            if (passes < 7) {
+               // only inflate as far as the passes that are used
+               stbi__uint32 prefix_len = 0;
+               for (k=0; k < passes; ++k)
+                  prefix_len += stbi__png_adam7_len(s, k, z->depth, NULL, NULL);
+               z->expanded = (stbi_uc *) stbi__zlib_decode_prefix((char *) z->idata, ioff, prefix_len, (int *) &raw_len, !is_iphone);
+            } else {
+               // initial guess for decoded data size to avoid unnecessary reallocs
+               bpl = (s->img_x * z->depth + 7) / 8; // bytes per line, per component
+               raw_len = bpl * s->img_y * s->img_n /* pixels */ + s->img_y /* filter mode per row */;
+               z->expanded = (stbi_uc *) stbi_zlib_decode_malloc_guesssize_headerflag((char *) z->idata, ioff, raw_len, (int *) &raw_len, !is_iphone);
+            }
             if (z->expanded == NULL) return 0; // zlib should set error
             STBI_FREE(z->idata); z->idata = NULL;
             if ((req_comp == s->img_n+1 && req_comp != 3 && !pal_img_n) || has_trans)
                s->img_out_n = s->img_n+1;
             else
                s->img_out_n = s->img_n;
-            if (!stbi__create_png_image(z, z->expanded, raw_len, s->img_out_n, z->depth, color, interlace)) return 0;
+            if (!stbi__create_png_image(z, z->expanded, raw_len, s->img_out_n, z->depth, color, interlace, passes)) return 0;
             if (has_trans) {
                if (z->depth == 16) {
                   if (!stbi__compute_transparency16(z, tc16, s->img_out_n)) return 0;
@@ -4904,7 +6868,8 @@ static void *stbi__do_png(stbi__png *p, int *x, int *y, int *n, int req_comp, st
 {
    void *result=NULL;
    if (req_comp < 0 || req_comp > 4) return stbi__errpuc("bad req_comp", "Internal error");
-   if (stbi__parse_png_file(p, STBI__SCAN_load, req_comp)) {
+   // when streaming, the rows are gone already and there's no out
+   if (stbi__parse_png_file(p, STBI__SCAN_load, req_comp) && p->out) {
       if (p->depth < 8)
          ri->bits_per_channel = 8;
       else
@@ -4934,9 +6899,29 @@ static void *stbi__png_load(stbi__context *s, int *x, int *y, int *comp, int req
 {
    stbi__png p;
    p.s = s;
+   p.rows = NULL;
    return stbi__do_png(&p, x,y,comp,req_comp, ri);
 }
 
+static int stbi__png_load_rows(stbi__context *s, stbi__rows *rows)
+{
+   stbi__png p;
+   stbi__result_info ri;
+   int x = 0, y = 0, comp = 0;
+   void *result;
+   p.s = s;
+   p.rows = rows;
+   result = stbi__do_png(&p, &x, &y, &comp, rows->req_comp, &ri);
+   // every row was passed on, even if the chunks after them were broken
+   if (rows->done) return 1;
+   if (result == NULL) return 0;
+   // interlaced, so it had to be loaded whole
+   if (ri.bits_per_channel != 8)
+      result = stbi__convert_16_to_8((stbi__uint16 *) result, x, y, rows->req_comp ? rows->req_comp : s->img_out_n);
+   // img_n leaves out the alpha of tRNS, which the rows have without req_comp
+   return stbi__rows_whole(rows, (stbi_uc *) result, x, y, rows->req_comp ? comp : s->img_out_n);
+}
+
 static int stbi__png_test(stbi__context *s)
 {
    int r;
@@ -4961,6 +6946,7 @@ static int stbi__png_info(stbi__context *s, int *x, int *y, int *comp)
 {
    stbi__png p;
    p.s = s;
+   p.rows = NULL;
    return stbi__png_info_raw(&p, x, y, comp);
 }
 
@@ -4968,6 +6954,7 @@ static int stbi__png_is16(stbi__context *s)
 {
    stbi__png p;
    p.s = s;
+   p.rows = NULL;
    if (!stbi__png_info_raw(&p, NULL, NULL, NULL))
 	   return 0;
    if (p.depth != 16) {
@@ -6201,6 +8188,7 @@ static int stbi__gif_header(stbi__context *s, stbi__gif *g, int *comp, int is_in
 static int stbi__gif_info_raw(stbi__context *s, int *x, int *y, int *comp)
 {
    stbi__gif* g = (stbi__gif*) stbi__malloc(sizeof(stbi__gif));
+   if (!g) return stbi__err("outofmem", "Out of memory");
    if (!stbi__gif_header(s, g, comp, 1)) {
       STBI_FREE(g);
       stbi__rewind( s );
@@ -6851,7 +8839,7 @@ static int stbi__bmp_info(stbi__context *s, int *x, int *y, int *comp)
    if (p == NULL)
       return 0;
    if (x) *x = s->img_x;
-   if (y) *y = s->img_y;
+   if (y) *y = abs((int) s->img_y); // negative for top-down images
    if (comp) *comp = info.ma ? 4 : 3;
    return 1;
 }
@@ -7149,6 +9137,47 @@ static int stbi__info_main(stbi__context *s, int *x, int *y, int *comp)
    return stbi__err("unknown image type", "Image not of any known type, or corrupt");
 }
 
+static int stbi__info_whole_main(stbi__context *s, int *x, int *y, int *comp)
+{
+   // the same choice stbi__load_rows makes
+   if (!stbi__vertically_flip_on_load) {
+      #ifndef STBI_NO_PNG
+      if (stbi__png_test(s)) {
+         stbi__png p;
+         int xgrid, ygrid;
+         p.s = s;
+         p.rows = NULL;
+         if (!stbi__png_info_raw(&p, x, y, comp) || !p.passes) return 0;
+         // the grid the passes fill, as in stbi__create_png_image
+         xgrid = stbi__adam7_xgrid[p.passes-1];
+         ygrid = stbi__adam7_ygrid[p.passes-1];
+         if (x) *x = (int) ((s->img_x + xgrid-1) / xgrid);
+         if (y) *y = (int) ((s->img_y + ygrid-1) / ygrid);
+         return 1;
+      }
+      #endif
+      #ifndef STBI_NO_JPEG
+      if (stbi__jpeg_test(s)) {
+         int r, shift;
+         stbi__jpeg* j = (stbi__jpeg*) stbi__malloc(sizeof(stbi__jpeg));
+         if (!j) return stbi__err("outofmem", "Out of memory");
+         j->s = s;
+         stbi__setup_jpeg(j);
+         r = stbi__decode_jpeg_header(j, STBI__SCAN_header) && j->progressive;
+         if (r) {
+            shift = stbi__jpeg_scale_shift(s);
+            if (x) *x = (int) ((s->img_x + (1 << shift) - 1) >> shift);
+            if (y) *y = (int) ((s->img_y + (1 << shift) - 1) >> shift);
+            if (comp) *comp = s->img_n >= 3 ? 3 : 1;
+         }
+         STBI_FREE(j);
+         return r;
+      }
+      #endif
+   }
+   return stbi__info_main(s, x, y, comp);
+}
+
 static int stbi__is_16_main(stbi__context *s)
 {
    #ifndef STBI_NO_PNG
@@ -7184,6 +9213,27 @@ STBIDEF int stbi_info_from_file(FILE *f, int *x, int *y, int *comp)
    return r;
 }
 
+STBIDEF int stbi_info_whole(char const *filename, int *x, int *y, int *comp)
+{
+   FILE *f = stbi__fopen(filename, "rb");
+   int result;
+   if (!f) return stbi__err("can't fopen", "Unable to open file");
+   result = stbi_info_whole_from_file(f, x, y, comp);
+   fclose(f);
+   return result;
+}
+
+STBIDEF int stbi_info_whole_from_file(FILE *f, int *x, int *y, int *comp)
+{
+   int r;
+   stbi__context s;
+   long pos = ftell(f);
+   stbi__start_file(&s, f);
+   r = stbi__info_whole_main(&s,x,y,comp);
+   fseek(f,pos,SEEK_SET);
+   return r;
+}
+
 STBIDEF int stbi_is_16_bit(char const *filename)
 {
     FILE *f = stbi__fopen(filename, "rb");
@@ -7220,6 +9270,20 @@ STBIDEF int stbi_info_from_callbacks(stbi_io_callbacks const *c, void *user, int
    return stbi__info_main(&s,x,y,comp);
 }
 
+STBIDEF int stbi_info_whole_from_memory(stbi_uc const *buffer, int len, int *x, int *y, int *comp)
+{
+   stbi__context s;
+   stbi__start_mem(&s,buffer,len);
+   return stbi__info_whole_main(&s,x,y,comp);
+}
+
+STBIDEF int stbi_info_whole_from_callbacks(stbi_io_callbacks const *c, void *user, int *x, int *y, int *comp)
+{
+   stbi__context s;
+   stbi__start_callbacks(&s, (stbi_io_callbacks *) c, user);
+   return stbi__info_whole_main(&s,x,y,comp);
+}
+
 STBIDEF int stbi_is_16_bit_from_memory(stbi_uc const *buffer, int len)
 {
    stbi__context s;
@@ -7234,6 +9298,111 @@ STBIDEF int stbi_is_16_bit_from_callbacks(stbi_io_callbacks const *c, void *user
    return stbi__is_16_main(&s);
 }
 
+// points the layout at the rows at offset start of the buffer, if they fit
+static int stbi__raw_rows(stbi__context *s, stbi_raw_layout *r, int start, int stride, int bottom_up)
+{
+   int len = (int) (s->img_buffer_original_end - s->img_buffer_original);
+   if (r->x <= 0 || r->y <= 0 || start < 0 || start > len) return 0;
+   if (!stbi__mad3sizes_valid(r->x, r->y, r->channels, 0)) return 0;
+   if (!stbi__mad2sizes_valid(stride, r->y-1, r->x * r->channels)) return 0;
+   if (stride * (r->y-1) + r->x * r->channels > len - start) return 0;
+   r->data = s->img_buffer_original + start;
+   r->stride = stride;
+   if (bottom_up != stbi__vertically_flip_on_load) {
+      r->data += stride * (r->y-1);
+      r->stride = -stride;
+   }
+   return 1;
+}
+
+#ifndef STBI_NO_BMP
+static int stbi__bmp_raw_layout(stbi__context *s, stbi_raw_layout *r)
+{
+   stbi__bmp_data info;
+   int skip;
+   info.all_a = 255;
+   if (stbi__bmp_parse_header(s, &info) == NULL) return 0;
+   // 32-bit may have an alpha channel of all 0s that has to be replaced
+   if (info.bpp != 24) return 0;
+   skip = info.offset - 14 - info.hsz;
+   if (skip < 0 || skip > (int) (s->img_buffer_end - s->img_buffer)) return 0;
+   r->x = s->img_x;
+   r->y = abs((int) s->img_y);
+   r->channels = 3;
+   r->bgr = 1;
+   return stbi__raw_rows(s, r, (int) (s->img_buffer - s->img_buffer_original) + skip, (3 * r->x + 3) & ~3, ((int) s->img_y) > 0);
+}
+#endif
+
+#ifndef STBI_NO_TGA
+static int stbi__tga_raw_layout(stbi__context *s, stbi_raw_layout *r)
+{
+   int tga_offset = stbi__get8(s);
+   int tga_indexed = stbi__get8(s);
+   int tga_image_type = stbi__get8(s);
+   int tga_bits_per_pixel, tga_inverted, tga_rgb16;
+   stbi__skip(s, 9); // palette specification, x and y origin
+   r->x = stbi__get16le(s);
+   r->y = stbi__get16le(s);
+   tga_bits_per_pixel = stbi__get8(s);
+   tga_inverted = stbi__get8(s);
+   if (tga_indexed || (tga_image_type != 2 && tga_image_type != 3)) return 0;
+   r->channels = stbi__tga_get_comp(tga_bits_per_pixel, tga_image_type == 3, &tga_rgb16);
+   if (!r->channels || tga_rgb16) return 0;
+   r->bgr = r->channels >= 3;
+   return stbi__raw_rows(s, r, (int) (s->img_buffer - s->img_buffer_original) + tga_offset, r->x * r->channels, !((tga_inverted >> 5) & 1));
+}
+#endif
+
+#ifndef STBI_NO_PNM
+static int stbi__pnm_raw_layout(stbi__context *s, stbi_raw_layout *r)
+{
+   if (!stbi__pnm_info(s, &r->x, &r->y, &r->channels)) return 0;
+   r->bgr = 0;
+   return stbi__raw_rows(s, r, (int) (s->img_buffer - s->img_buffer_original), r->x * r->channels, 0);
+}
+#endif
+
+static int stbi__raw_layout(stbi__context *s, stbi_raw_layout *r)
+{
+   // only where stbi__load_main() would pick the same format
+   #ifndef STBI_NO_JPEG
+   if (stbi__jpeg_test(s)) return 0;
+   #endif
+   #ifndef STBI_NO_PNG
+   if (stbi__png_test(s))  return 0;
+   #endif
+   #ifndef STBI_NO_BMP
+   if (stbi__bmp_test(s))  return stbi__bmp_raw_layout(s, r);
+   #endif
+   #ifndef STBI_NO_GIF
+   if (stbi__gif_test(s))  return 0;
+   #endif
+   #ifndef STBI_NO_PSD
+   if (stbi__psd_test(s))  return 0;
+   #endif
+   #ifndef STBI_NO_PIC
+   if (stbi__pic_test(s))  return 0;
+   #endif
+   #ifndef STBI_NO_PNM
+   if (stbi__pnm_test(s))  return stbi__pnm_raw_layout(s, r);
+   #endif
+   #ifndef STBI_NO_HDR
+   if (stbi__hdr_test(s))  return 0;
+   #endif
+   #ifndef STBI_NO_TGA
+   if (stbi__tga_test(s))  return stbi__tga_raw_layout(s, r);
+   #endif
+   return 0;
+}
+
+STBIDEF int stbi_raw_layout_from_memory(stbi_uc const *buffer, int len, stbi_raw_layout *layout)
+{
+   stbi__context s;
+   stbi__start_mem(&s,buffer,len);
+   return stbi__raw_layout(&s, layout);
+}
+
 #endif // STB_IMAGE_IMPLEMENTATION
 
 /*
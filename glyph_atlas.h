@@ -0,0 +1,1843 @@
+/*
+ *  Copyright 2018 Julius Ikkala
+ *
+ *  This file is part of img2string.
+ *
+ *  img2string is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  img2string is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with img2string.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef IMG2STRING_GLYPH_ATLAS_H
+#define IMG2STRING_GLYPH_ATLAS_H
+#include <stdint.h>
+
+/* Coverage bitmaps of the printable ASCII characters ' ' to '~', 8x16 pixels
+ * each, row by row. Rasterized from Source Code Pro Regular (SIL Open Font
+ * License) with 8x8 supersampling, the cell spanning the advance width and
+ * the ascender to the descender of the font.
+ */
+#define GLYPH_ATLAS_FIRST 0x20
+#define GLYPH_ATLAS_COUNT 95
+#define GLYPH_ATLAS_WIDTH 8
+#define GLYPH_ATLAS_HEIGHT 16
+
+static const uint8_t glyph_atlas[GLYPH_ATLAS_COUNT][
+    GLYPH_ATLAS_WIDTH * GLYPH_ATLAS_HEIGHT
+] = {
+    /* ' ' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '!' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xEF, 0xEF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '"' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x10, 0x40, 0x10, 0x10, 0x40, 0x10, 0x00,
+        0x00, 0x40, 0xFF, 0x2C, 0x2C, 0xFF, 0x40, 0x00,
+        0x00, 0x34, 0xFF, 0x20, 0x20, 0xFF, 0x34, 0x00,
+        0x00, 0x18, 0xFF, 0x04, 0x04, 0xFF, 0x18, 0x00,
+        0x00, 0x00, 0xDF, 0x00, 0x00, 0xDF, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '#' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x14, 0x78, 0x00, 0x78, 0x14, 0x00,
+        0x00, 0x00, 0x34, 0x83, 0x00, 0xB3, 0x00, 0x00,
+        0x00, 0x3C, 0x8F, 0x9F, 0x60, 0xD3, 0x54, 0x00,
+        0x00, 0x3C, 0xAF, 0x87, 0x60, 0xD3, 0x54, 0x00,
+        0x00, 0x00, 0x97, 0x20, 0x1C, 0x9B, 0x00, 0x00,
+        0x00, 0x8B, 0xDF, 0x9F, 0xB3, 0xCB, 0x64, 0x00,
+        0x00, 0x00, 0xB7, 0x00, 0x5C, 0x5C, 0x00, 0x00,
+        0x00, 0x00, 0xB7, 0x00, 0x80, 0x38, 0x00, 0x00,
+        0x00, 0x0C, 0x50, 0x00, 0x50, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '$' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0x87, 0xA3, 0x1C, 0x00, 0x00,
+        0x00, 0x20, 0xE3, 0x9B, 0x8B, 0xDF, 0x4C, 0x00,
+        0x00, 0x78, 0xA7, 0x00, 0x00, 0x0C, 0x0C, 0x00,
+        0x00, 0x30, 0xE7, 0x83, 0x1C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x1C, 0x8B, 0xE7, 0xAF, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x08, 0x97, 0xB7, 0x00,
+        0x00, 0x54, 0x30, 0x00, 0x00, 0x64, 0xBF, 0x00,
+        0x00, 0x54, 0xCF, 0xD3, 0xCB, 0xC7, 0x28, 0x00,
+        0x00, 0x00, 0x00, 0x64, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x54, 0x70, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '%' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0C, 0x93, 0xA7, 0x3C, 0x00, 0x00, 0x18, 0x18,
+        0x83, 0x5C, 0x0C, 0xCF, 0x00, 0x0C, 0xC3, 0x4C,
+        0x9F, 0x2C, 0x00, 0xC3, 0x08, 0x9F, 0x54, 0x00,
+        0x54, 0x9B, 0x50, 0xC3, 0x10, 0x38, 0x00, 0x00,
+        0x00, 0x44, 0x60, 0x10, 0x1C, 0x78, 0x5C, 0x00,
+        0x00, 0x00, 0x83, 0x10, 0xC7, 0x38, 0x87, 0x68,
+        0x00, 0x8F, 0x6C, 0x08, 0xBF, 0x00, 0x2C, 0x9F,
+        0x5C, 0x8B, 0x00, 0x00, 0xD3, 0x18, 0x6C, 0x78,
+        0x00, 0x04, 0x00, 0x00, 0x34, 0x9B, 0x83, 0x04,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '&' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x04, 0xAB, 0xC7, 0xB3, 0x04, 0x00, 0x00,
+        0x00, 0x50, 0xAB, 0x00, 0xB7, 0x38, 0x00, 0x00,
+        0x00, 0x54, 0xA3, 0x18, 0xD7, 0x0C, 0x00, 0x00,
+        0x00, 0x10, 0xE7, 0xC7, 0x3C, 0x00, 0x00, 0x00,
+        0x00, 0x70, 0xE7, 0xA3, 0x00, 0x00, 0x8F, 0x70,
+        0x3C, 0xDB, 0x10, 0xBF, 0x70, 0x08, 0xDF, 0x18,
+        0x68, 0xA7, 0x00, 0x14, 0xD3, 0xCB, 0x87, 0x00,
+        0x24, 0xEB, 0x60, 0x2C, 0x9F, 0xE7, 0xC7, 0x3C,
+        0x00, 0x2C, 0x97, 0x9F, 0x68, 0x04, 0x4C, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* ''' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAB, 0xAB, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8B, 0x8B, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '(' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0x83, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x9B, 0x8F, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x4C, 0xBF, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCB, 0x3C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x14, 0xEB, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x38, 0xC3, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x38, 0xC3, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0xEB, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xC3, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x48, 0xC3, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x8B, 0x8F, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1C, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* ')' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x18, 0x83, 0x04, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x8F, 0x9B, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x4C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x38, 0xCB, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xEB, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xC3, 0x38, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xC3, 0x38, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xEB, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x3C, 0xC3, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xC3, 0x48, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x8F, 0x8B, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '*' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x8B, 0x7C, 0x83, 0x83, 0x7C, 0x8B, 0x00,
+        0x00, 0x04, 0x4C, 0xEB, 0xEB, 0x4C, 0x04, 0x00,
+        0x00, 0x00, 0x54, 0xAB, 0xAB, 0x54, 0x00, 0x00,
+        0x00, 0x04, 0xBB, 0x0C, 0x0C, 0xBB, 0x04, 0x00,
+        0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '+' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x1C, 0x20, 0x8F, 0x8F, 0x20, 0x1C, 0x00,
+        0x00, 0xA7, 0xBF, 0xDF, 0xDF, 0xBF, 0xA7, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* ',' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x54, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xF7, 0xFF, 0x2C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x4C, 0xDF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x18, 0xDF, 0x0C, 0x00, 0x00,
+        0x00, 0x00, 0x2C, 0xCF, 0x44, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '-' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1C, 0x20, 0x20, 0x20, 0x20, 0x1C, 0x00,
+        0x00, 0xA7, 0xBF, 0xBF, 0xBF, 0xBF, 0xA7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '.' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '/' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x48, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0x48, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x1C, 0xDB, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0xDF, 0x1C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x48, 0xB3, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAB, 0x4C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0xDF, 0x04, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x78, 0x87, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x48, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '0' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x54, 0xB3, 0xB3, 0x58, 0x00, 0x00,
+        0x00, 0x58, 0xD7, 0x30, 0x30, 0xD7, 0x58, 0x00,
+        0x00, 0xCB, 0x3C, 0x00, 0x00, 0x3C, 0xCB, 0x00,
+        0x00, 0xFF, 0x08, 0x44, 0x44, 0x08, 0xFF, 0x00,
+        0x00, 0xFF, 0x00, 0xC7, 0xC7, 0x00, 0xFF, 0x00,
+        0x00, 0xFB, 0x0C, 0x14, 0x14, 0x0C, 0xFB, 0x00,
+        0x00, 0xC3, 0x48, 0x00, 0x00, 0x48, 0xC3, 0x00,
+        0x00, 0x44, 0xD7, 0x44, 0x44, 0xD7, 0x44, 0x00,
+        0x00, 0x00, 0x3C, 0x9B, 0x9B, 0x3C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '1' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x1C, 0x60, 0x8B, 0x00, 0x00, 0x00,
+        0x00, 0x14, 0x9F, 0xB7, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x48, 0x60, 0x87, 0xEB, 0x60, 0x60, 0x0C,
+        0x00, 0x60, 0x80, 0x80, 0x80, 0x80, 0x80, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '2' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x14, 0x87, 0xBF, 0xA7, 0x44, 0x00, 0x00,
+        0x00, 0xC3, 0x68, 0x20, 0x48, 0xE7, 0x38, 0x00,
+        0x00, 0x04, 0x00, 0x00, 0x00, 0x9B, 0x7C, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x54, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x60, 0xC3, 0x04, 0x00,
+        0x00, 0x00, 0x00, 0x54, 0xD3, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x6C, 0xCF, 0x18, 0x00, 0x00, 0x00,
+        0x00, 0x8B, 0xEF, 0x6C, 0x60, 0x60, 0x60, 0x00,
+        0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '3' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x18, 0x83, 0xBB, 0xAF, 0x60, 0x00, 0x00,
+        0x00, 0x93, 0x64, 0x24, 0x38, 0xDB, 0x68, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x97, 0x00,
+        0x00, 0x00, 0x08, 0x24, 0x60, 0xD7, 0x28, 0x00,
+        0x00, 0x00, 0x30, 0xBF, 0xE3, 0x80, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xAB, 0x00,
+        0x00, 0x04, 0x00, 0x00, 0x00, 0x44, 0xDF, 0x00,
+        0x10, 0xDB, 0x6C, 0x40, 0x4C, 0xCB, 0x80, 0x00,
+        0x00, 0x18, 0x80, 0x9F, 0x9B, 0x54, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '4' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x48, 0x9F, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2C, 0xCF, 0xFF, 0x00, 0x00,
+        0x00, 0x00, 0x14, 0xD7, 0x48, 0xFF, 0x00, 0x00,
+        0x00, 0x04, 0xBF, 0x5C, 0x20, 0xFF, 0x00, 0x00,
+        0x00, 0x97, 0x83, 0x00, 0x20, 0xFF, 0x00, 0x00,
+        0x58, 0xF3, 0x80, 0x80, 0x8F, 0xFF, 0x80, 0x20,
+        0x20, 0x40, 0x40, 0x40, 0x58, 0xFF, 0x40, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '5' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2C, 0x9F, 0x9F, 0x9F, 0x9F, 0x50, 0x00,
+        0x00, 0x60, 0xBB, 0x40, 0x40, 0x40, 0x20, 0x00,
+        0x00, 0x6C, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xB3, 0x93, 0x97, 0x58, 0x00, 0x00,
+        0x00, 0x40, 0x74, 0x2C, 0x48, 0xCF, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xEF, 0x00,
+        0x00, 0x04, 0x00, 0x00, 0x00, 0x3C, 0xE3, 0x00,
+        0x10, 0xD7, 0x68, 0x40, 0x54, 0xDB, 0x68, 0x00,
+        0x00, 0x20, 0x83, 0x9F, 0x97, 0x44, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '6' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x20, 0x93, 0xBF, 0xA3, 0x38, 0x00,
+        0x00, 0x20, 0xE3, 0x70, 0x24, 0x48, 0x74, 0x00,
+        0x00, 0x97, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xDB, 0x2C, 0x44, 0x64, 0x44, 0x00, 0x00,
+        0x00, 0xFF, 0xB3, 0x7C, 0x60, 0xBB, 0x9F, 0x00,
+        0x00, 0xEF, 0x38, 0x00, 0x00, 0x08, 0xF7, 0x14,
+        0x00, 0xB7, 0x58, 0x00, 0x00, 0x04, 0xF3, 0x14,
+        0x00, 0x34, 0xDB, 0x4C, 0x2C, 0x9F, 0x9F, 0x00,
+        0x00, 0x00, 0x2C, 0x93, 0x9F, 0x6C, 0x04, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '7' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x14, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x14,
+        0x08, 0x40, 0x40, 0x40, 0x40, 0x8F, 0xAF, 0x04,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0xD3, 0x0C, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xB7, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x34, 0xD3, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x87, 0x87, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xC3, 0x54, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xE7, 0x3C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '8' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x5C, 0xB3, 0xB7, 0x74, 0x04, 0x00,
+        0x00, 0x58, 0xC7, 0x1C, 0x14, 0xAF, 0x7C, 0x00,
+        0x00, 0x80, 0x83, 0x00, 0x00, 0x44, 0xAF, 0x00,
+        0x00, 0x28, 0xDB, 0x5C, 0x0C, 0xAB, 0x4C, 0x00,
+        0x00, 0x10, 0xAB, 0xAB, 0xEB, 0xC3, 0x10, 0x00,
+        0x00, 0xCF, 0x3C, 0x00, 0x08, 0x80, 0xCB, 0x00,
+        0x14, 0xEB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x10,
+        0x00, 0xBF, 0x97, 0x28, 0x24, 0x8B, 0xBF, 0x00,
+        0x00, 0x08, 0x6C, 0x9F, 0x9F, 0x70, 0x0C, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '9' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x08, 0x7C, 0xBB, 0xA7, 0x3C, 0x00, 0x00,
+        0x00, 0xB3, 0x93, 0x24, 0x38, 0xD7, 0x40, 0x00,
+        0x14, 0xF7, 0x04, 0x00, 0x00, 0x54, 0xC3, 0x00,
+        0x0C, 0xFB, 0x10, 0x00, 0x00, 0x38, 0xF3, 0x00,
+        0x00, 0x8B, 0xCB, 0x6C, 0x93, 0xAF, 0xFF, 0x00,
+        0x00, 0x00, 0x34, 0x60, 0x30, 0x2C, 0xDF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x97, 0x00,
+        0x00, 0x8B, 0x5C, 0x40, 0x7C, 0xE3, 0x1C, 0x00,
+        0x00, 0x28, 0x8B, 0x9F, 0x83, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* ':' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xD7, 0xD7, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xE7, 0xE7, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* ';' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xD7, 0xD7, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xE7, 0xE7, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x54, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xF7, 0xFF, 0x2C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x4C, 0xDF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x18, 0xDF, 0x0C, 0x00, 0x00,
+        0x00, 0x00, 0x2C, 0xCF, 0x44, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '<' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x10, 0x9F, 0x8B, 0x00,
+        0x00, 0x00, 0x00, 0x54, 0xD7, 0x60, 0x00, 0x00,
+        0x00, 0x18, 0xAB, 0xAB, 0x18, 0x00, 0x00, 0x00,
+        0x00, 0x50, 0xD7, 0x20, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x48, 0xD3, 0x6C, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0x93, 0xC3, 0x28, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x78, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '=' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x54, 0x60, 0x60, 0x60, 0x60, 0x54, 0x00,
+        0x00, 0x54, 0x60, 0x60, 0x60, 0x60, 0x54, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xA7, 0xBF, 0xBF, 0xBF, 0xBF, 0xA7, 0x00,
+        0x00, 0x1C, 0x20, 0x20, 0x20, 0x20, 0x1C, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '>' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x8B, 0x9F, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x60, 0xD7, 0x54, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x18, 0xAB, 0xAB, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0xD7, 0x50, 0x00,
+        0x00, 0x00, 0x04, 0x6C, 0xD3, 0x48, 0x00, 0x00,
+        0x00, 0x28, 0xC3, 0x93, 0x0C, 0x00, 0x00, 0x00,
+        0x00, 0x78, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '?' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x1C, 0x18, 0x00, 0x00, 0x00,
+        0x00, 0x30, 0xCF, 0xC3, 0xD7, 0xB7, 0x08, 0x00,
+        0x00, 0x14, 0x28, 0x00, 0x04, 0xD3, 0x58, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x08, 0xDB, 0x3C, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0xBB, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9B, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x78, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0xFF, 0xB7, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x8F, 0x58, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '@' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0x64, 0x80, 0x6C, 0x08, 0x00,
+        0x00, 0x24, 0xCB, 0x64, 0x20, 0x6C, 0xB3, 0x00,
+        0x00, 0xBF, 0x38, 0x00, 0x00, 0x00, 0x9F, 0x28,
+        0x20, 0xBF, 0x00, 0x00, 0x0C, 0x48, 0xAF, 0x40,
+        0x50, 0x8B, 0x00, 0x68, 0xBB, 0x6C, 0xB7, 0x40,
+        0x60, 0x80, 0x00, 0xE3, 0x04, 0x00, 0x9F, 0x40,
+        0x44, 0x93, 0x00, 0xCB, 0x70, 0x7C, 0xC7, 0x40,
+        0x10, 0xCF, 0x00, 0x10, 0x5C, 0x38, 0x18, 0x10,
+        0x00, 0x93, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0C, 0xAF, 0x93, 0x60, 0x74, 0x7C, 0x00,
+        0x00, 0x00, 0x00, 0x2C, 0x60, 0x40, 0x04, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'A' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xA7, 0xA7, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x1C, 0xD3, 0xDB, 0x1C, 0x00, 0x00,
+        0x00, 0x00, 0x70, 0x83, 0x8F, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xCF, 0x34, 0x3C, 0xCF, 0x00, 0x00,
+        0x00, 0x24, 0xE3, 0x00, 0x00, 0xE3, 0x24, 0x00,
+        0x00, 0x83, 0xF7, 0xDF, 0xDF, 0xF7, 0x83, 0x00,
+        0x00, 0xDB, 0x3C, 0x00, 0x00, 0x44, 0xDB, 0x00,
+        0x38, 0xE3, 0x00, 0x00, 0x00, 0x04, 0xEB, 0x38,
+        0x3C, 0x54, 0x00, 0x00, 0x00, 0x00, 0x58, 0x3C,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'B' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x8B, 0xDF, 0xDF, 0xC7, 0x8F, 0x14, 0x00,
+        0x00, 0x9F, 0x74, 0x20, 0x28, 0xA7, 0xA7, 0x00,
+        0x00, 0x9F, 0x60, 0x00, 0x00, 0x54, 0xBB, 0x00,
+        0x00, 0x9F, 0x87, 0x4C, 0x68, 0xCB, 0x4C, 0x00,
+        0x00, 0x9F, 0xC3, 0x9F, 0x9F, 0xBF, 0x78, 0x00,
+        0x00, 0x9F, 0x60, 0x00, 0x00, 0x0C, 0xE7, 0x30,
+        0x00, 0x9F, 0x60, 0x00, 0x00, 0x04, 0xDF, 0x3C,
+        0x00, 0x9F, 0x9B, 0x60, 0x68, 0xB7, 0xC3, 0x04,
+        0x00, 0x50, 0x80, 0x80, 0x80, 0x4C, 0x04, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'C' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x44, 0xC3, 0xFB, 0xE7, 0x78, 0x04,
+        0x00, 0x48, 0xEB, 0x4C, 0x00, 0x14, 0x7C, 0x04,
+        0x00, 0xCF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x14, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x20, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0C, 0xFB, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xAF, 0x93, 0x00, 0x00, 0x00, 0x08, 0x00,
+        0x00, 0x20, 0xE7, 0x93, 0x44, 0x5C, 0xD7, 0x24,
+        0x00, 0x00, 0x14, 0x7C, 0x9F, 0x93, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'D' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xC3, 0xDF, 0xD3, 0xB3, 0x58, 0x00, 0x00,
+        0x00, 0xDF, 0x40, 0x0C, 0x40, 0xD7, 0x83, 0x00,
+        0x00, 0xDF, 0x40, 0x00, 0x00, 0x24, 0xFB, 0x1C,
+        0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0xD3, 0x54,
+        0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x60,
+        0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0xEB, 0x44,
+        0x00, 0xDF, 0x40, 0x00, 0x00, 0x58, 0xE7, 0x08,
+        0x00, 0xDF, 0x87, 0x60, 0x8F, 0xEB, 0x44, 0x00,
+        0x00, 0x70, 0x80, 0x80, 0x68, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'E' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x70, 0xDF, 0xDF, 0xDF, 0xDF, 0xC3, 0x00,
+        0x00, 0x80, 0xAB, 0x20, 0x20, 0x20, 0x1C, 0x00,
+        0x00, 0x80, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xB7, 0x40, 0x40, 0x40, 0x10, 0x00,
+        0x00, 0x80, 0xDB, 0x9F, 0x9F, 0x9F, 0x28, 0x00,
+        0x00, 0x80, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xC3, 0x60, 0x60, 0x60, 0x60, 0x0C,
+        0x00, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'F' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x38, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x1C,
+        0x00, 0x40, 0xE3, 0x20, 0x20, 0x20, 0x20, 0x04,
+        0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0xE3, 0x20, 0x20, 0x20, 0x10, 0x00,
+        0x00, 0x40, 0xF7, 0xBF, 0xBF, 0xBF, 0x60, 0x00,
+        0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'G' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x64, 0xD3, 0xFF, 0xD7, 0x5C, 0x00,
+        0x00, 0x74, 0xD7, 0x30, 0x00, 0x24, 0x70, 0x00,
+        0x08, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x38, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x40, 0xDF, 0x00, 0x00, 0x78, 0xBF, 0xBF, 0x18,
+        0x30, 0xF7, 0x08, 0x00, 0x14, 0x20, 0xE3, 0x20,
+        0x00, 0xDB, 0x60, 0x00, 0x00, 0x00, 0xDF, 0x20,
+        0x00, 0x44, 0xEB, 0x78, 0x40, 0x6C, 0xF3, 0x18,
+        0x00, 0x00, 0x24, 0x8B, 0x9F, 0x8B, 0x2C, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'H' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0x1C, 0x00, 0x00, 0x1C, 0xDF, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xFF, 0x74, 0x60, 0x60, 0x74, 0xFF, 0x00,
+        0x00, 0xFF, 0xAB, 0x9F, 0x9F, 0xAB, 0xFF, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0x80, 0x10, 0x00, 0x00, 0x10, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'I' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xA7, 0xDF, 0xDF, 0xDF, 0xDF, 0xA7, 0x00,
+        0x00, 0x18, 0x20, 0x8F, 0x8F, 0x20, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x48, 0x60, 0xAF, 0xAF, 0x60, 0x48, 0x00,
+        0x00, 0x60, 0x80, 0x80, 0x80, 0x80, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'J' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x38, 0xDF, 0xDF, 0xDF, 0xDF, 0x8B, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9F, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9F, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9F, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9F, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9F, 0x00,
+        0x00, 0x18, 0x00, 0x00, 0x00, 0x9F, 0x80, 0x00,
+        0x00, 0xAB, 0xA7, 0x44, 0x68, 0xF3, 0x30, 0x00,
+        0x00, 0x08, 0x70, 0x9F, 0x97, 0x3C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'K' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xA7, 0x54, 0x00, 0x00, 0x30, 0xCF, 0x1C,
+        0x00, 0xBF, 0x60, 0x00, 0x1C, 0xE3, 0x44, 0x00,
+        0x00, 0xBF, 0x60, 0x0C, 0xD7, 0x60, 0x00, 0x00,
+        0x00, 0xBF, 0x64, 0xC3, 0xCF, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0xE7, 0x9F, 0xD7, 0x58, 0x00, 0x00,
+        0x00, 0xBF, 0xBB, 0x04, 0x48, 0xE3, 0x0C, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0xB3, 0x83, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x24, 0xEF, 0x24,
+        0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x58, 0x48,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'L' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x38, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0xEB, 0x60, 0x60, 0x60, 0x60, 0x18,
+        0x00, 0x20, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'M' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0x68, 0x00, 0x00, 0x68, 0xDF, 0x00,
+        0x00, 0xF7, 0xC3, 0x00, 0x00, 0xC3, 0xF3, 0x00,
+        0x00, 0xE3, 0xCF, 0x1C, 0x24, 0xC7, 0xEB, 0x00,
+        0x00, 0xFF, 0x7C, 0x7C, 0x7C, 0x74, 0xFF, 0x00,
+        0x00, 0xFF, 0x1C, 0xC7, 0xC3, 0x14, 0xFF, 0x00,
+        0x00, 0xFF, 0x00, 0xBB, 0xAF, 0x00, 0xFF, 0x00,
+        0x00, 0xFF, 0x00, 0x20, 0x1C, 0x00, 0xFF, 0x00,
+        0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+        0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'N' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xC3, 0x78, 0x00, 0x00, 0x1C, 0xC3, 0x00,
+        0x00, 0xDF, 0xDF, 0x14, 0x00, 0x20, 0xDF, 0x00,
+        0x00, 0xDF, 0x93, 0x8F, 0x00, 0x20, 0xDF, 0x00,
+        0x00, 0xDF, 0x30, 0xE7, 0x20, 0x20, 0xDF, 0x00,
+        0x00, 0xDF, 0x20, 0x78, 0x9F, 0x20, 0xDF, 0x00,
+        0x00, 0xDF, 0x20, 0x08, 0xE3, 0x4C, 0xDF, 0x00,
+        0x00, 0xDF, 0x20, 0x00, 0x64, 0xA7, 0xDF, 0x00,
+        0x00, 0xDF, 0x20, 0x00, 0x04, 0xD7, 0xDF, 0x00,
+        0x00, 0x70, 0x10, 0x00, 0x00, 0x3C, 0x70, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'O' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0C, 0x97, 0xEF, 0xEF, 0x97, 0x0C, 0x00,
+        0x00, 0xA7, 0xAF, 0x10, 0x10, 0xAF, 0xA7, 0x00,
+        0x1C, 0xFB, 0x18, 0x00, 0x00, 0x18, 0xFB, 0x1C,
+        0x50, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x50,
+        0x60, 0xC3, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x60,
+        0x40, 0xE7, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x40,
+        0x0C, 0xEF, 0x38, 0x00, 0x00, 0x38, 0xEF, 0x0C,
+        0x00, 0x68, 0xE3, 0x54, 0x54, 0xE3, 0x68, 0x00,
+        0x00, 0x00, 0x4C, 0x9B, 0x9B, 0x4C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'P' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x8B, 0xDF, 0xDF, 0xCB, 0xA3, 0x30, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0x10, 0x64, 0xEF, 0x0C,
+        0x00, 0x9F, 0x80, 0x00, 0x00, 0x00, 0xE3, 0x40,
+        0x00, 0x9F, 0x80, 0x00, 0x00, 0x1C, 0xF7, 0x1C,
+        0x00, 0x9F, 0xCF, 0x9F, 0xAF, 0xE7, 0x6C, 0x00,
+        0x00, 0x9F, 0x9F, 0x40, 0x34, 0x08, 0x00, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x50, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'Q' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0C, 0x97, 0xEF, 0xEF, 0x97, 0x0C, 0x00,
+        0x00, 0xA7, 0xAF, 0x10, 0x10, 0xAF, 0xA7, 0x00,
+        0x1C, 0xFB, 0x18, 0x00, 0x00, 0x18, 0xFB, 0x1C,
+        0x50, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x50,
+        0x60, 0xC3, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x60,
+        0x40, 0xE7, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x40,
+        0x0C, 0xEF, 0x30, 0x00, 0x00, 0x30, 0xEF, 0x0C,
+        0x00, 0x68, 0xD7, 0x50, 0x50, 0xD7, 0x68, 0x00,
+        0x00, 0x00, 0x4C, 0xC7, 0xE3, 0x4C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x1C, 0xE3, 0x83, 0x50, 0x18,
+        0x00, 0x00, 0x00, 0x00, 0x18, 0x7C, 0x9B, 0x2C,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'R' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x8B, 0xDF, 0xDF, 0xCF, 0xA3, 0x24, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0x10, 0x74, 0xE3, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x20,
+        0x00, 0x9F, 0x80, 0x00, 0x00, 0x60, 0xE3, 0x00,
+        0x00, 0x9F, 0xEF, 0xDF, 0xEB, 0xC7, 0x34, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0xB7, 0x83, 0x00, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0x24, 0xF3, 0x28, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0x00, 0x83, 0xBB, 0x00,
+        0x00, 0x50, 0x40, 0x00, 0x00, 0x08, 0x80, 0x1C,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'S' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0C, 0x93, 0xEB, 0xF7, 0xC3, 0x40, 0x00,
+        0x00, 0x83, 0xB7, 0x0C, 0x00, 0x44, 0x68, 0x00,
+        0x00, 0xA7, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x38, 0xF3, 0xA7, 0x38, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0x83, 0xE7, 0xCF, 0x38, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0x78, 0xEF, 0x0C,
+        0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x20,
+        0x04, 0xD3, 0xA3, 0x50, 0x48, 0x9F, 0xBF, 0x00,
+        0x00, 0x08, 0x68, 0x9F, 0x9F, 0x70, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'T' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x70, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x70,
+        0x10, 0x20, 0x20, 0x8F, 0x8F, 0x20, 0x20, 0x10,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'U' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0x1C, 0x00, 0x00, 0x1C, 0xDF, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xF7, 0x28, 0x00, 0x00, 0x20, 0xF7, 0x00,
+        0x00, 0xD3, 0x54, 0x00, 0x00, 0x4C, 0xD3, 0x00,
+        0x00, 0x68, 0xDF, 0x54, 0x54, 0xD7, 0x6C, 0x00,
+        0x00, 0x00, 0x54, 0x9B, 0x9F, 0x58, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'V' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x40, 0xC3, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x40,
+        0x08, 0xF3, 0x28, 0x00, 0x00, 0x1C, 0xF3, 0x08,
+        0x00, 0xA3, 0x7C, 0x00, 0x00, 0x70, 0xA3, 0x00,
+        0x00, 0x50, 0xC7, 0x00, 0x00, 0xBB, 0x50, 0x00,
+        0x00, 0x08, 0xF3, 0x1C, 0x10, 0xEF, 0x08, 0x00,
+        0x00, 0x00, 0xA3, 0x68, 0x5C, 0xA3, 0x00, 0x00,
+        0x00, 0x00, 0x50, 0xB3, 0xA3, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xEB, 0xE7, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5C, 0x5C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'W' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xB3, 0x60, 0x00, 0x00, 0x00, 0x00, 0x54, 0xB3,
+        0xA7, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAB,
+        0x80, 0xAB, 0x00, 0x5C, 0x6C, 0x00, 0x9B, 0x83,
+        0x54, 0xCB, 0x00, 0xCB, 0xE3, 0x00, 0xB7, 0x58,
+        0x2C, 0xEB, 0x18, 0xD3, 0xCF, 0x28, 0xD7, 0x34,
+        0x08, 0xFF, 0x60, 0x97, 0x8F, 0x70, 0xF3, 0x0C,
+        0x00, 0xD7, 0xB3, 0x58, 0x50, 0xBB, 0xE7, 0x00,
+        0x00, 0xAF, 0xFF, 0x18, 0x10, 0xF7, 0xBB, 0x00,
+        0x00, 0x4C, 0x74, 0x00, 0x00, 0x70, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'X' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0xBF, 0x4C, 0x00, 0x00, 0x40, 0xBF, 0x04,
+        0x00, 0x50, 0xDB, 0x04, 0x00, 0xCF, 0x50, 0x00,
+        0x00, 0x00, 0xB3, 0x78, 0x60, 0xB7, 0x00, 0x00,
+        0x00, 0x00, 0x20, 0xE7, 0xD7, 0x24, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xD3, 0xD7, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x70, 0x9F, 0xB7, 0x6C, 0x00, 0x00,
+        0x00, 0x1C, 0xEB, 0x1C, 0x28, 0xEB, 0x18, 0x00,
+        0x00, 0xA7, 0x7C, 0x00, 0x00, 0x87, 0xA7, 0x00,
+        0x10, 0x80, 0x08, 0x00, 0x00, 0x10, 0x80, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'Y' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x40, 0xC3, 0x04, 0x00, 0x00, 0x00, 0xBB, 0x40,
+        0x00, 0xC3, 0x60, 0x00, 0x00, 0x50, 0xC3, 0x00,
+        0x00, 0x3C, 0xE3, 0x08, 0x04, 0xD7, 0x3C, 0x00,
+        0x00, 0x00, 0xAF, 0x70, 0x60, 0xAF, 0x00, 0x00,
+        0x00, 0x00, 0x24, 0xE3, 0xD7, 0x24, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'Z' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xA7, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x18,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x9B, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x4C, 0xDB, 0x0C, 0x00,
+        0x00, 0x00, 0x00, 0x14, 0xE7, 0x34, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xB3, 0x78, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x6C, 0xBB, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2C, 0xE3, 0x1C, 0x00, 0x00, 0x00, 0x00,
+        0x08, 0xCF, 0xA7, 0x60, 0x60, 0x60, 0x60, 0x0C,
+        0x10, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '[' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0xE3, 0x20, 0x20, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xE3, 0x20, 0x20, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '\\' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x48, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x48, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xDB, 0x1C, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x1C, 0xDF, 0x04, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xB3, 0x48, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x4C, 0xAB, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0xDF, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x87, 0x78, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0xDF, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x40, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x48, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* ']' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x60, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x18, 0x20, 0x20, 0xE3, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x18, 0x20, 0x20, 0xE3, 0x00, 0x00, 0x00,
+        0x00, 0x60, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '^' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x1C, 0xC3, 0xC3, 0x1C, 0x00, 0x00,
+        0x00, 0x00, 0x87, 0x64, 0x64, 0x87, 0x00, 0x00,
+        0x00, 0x08, 0xDB, 0x0C, 0x0C, 0xDB, 0x08, 0x00,
+        0x00, 0x48, 0x8B, 0x00, 0x00, 0x8B, 0x48, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '_' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x28, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x28,
+        0x10, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '`' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x87, 0xB3, 0x04, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8B, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'a' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x10, 0x78, 0xBB, 0xC3, 0x97, 0x0C, 0x00,
+        0x00, 0x58, 0x70, 0x1C, 0x1C, 0xAF, 0x9B, 0x00,
+        0x00, 0x00, 0x00, 0x14, 0x44, 0x8B, 0xDB, 0x00,
+        0x00, 0x38, 0xC3, 0x9F, 0x6C, 0x80, 0xDF, 0x00,
+        0x00, 0xD7, 0x44, 0x00, 0x00, 0x40, 0xDF, 0x00,
+        0x00, 0xC3, 0x87, 0x2C, 0x5C, 0xC3, 0xDF, 0x00,
+        0x00, 0x1C, 0x8B, 0x9F, 0x6C, 0x10, 0x70, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'b' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x6C, 0x97, 0xBF, 0xA3, 0x18, 0x00,
+        0x00, 0xBF, 0xC7, 0x3C, 0x20, 0x97, 0xCB, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x0C, 0xFF, 0x1C,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0xF7, 0x34,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x24, 0xFB, 0x10,
+        0x00, 0xBF, 0xC7, 0x54, 0x48, 0xC7, 0x83, 0x00,
+        0x00, 0x60, 0x28, 0x87, 0x9F, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'c' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x38, 0xA3, 0xC3, 0xB3, 0x4C, 0x00,
+        0x00, 0x4C, 0xE7, 0x54, 0x10, 0x38, 0x83, 0x00,
+        0x00, 0xCB, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xC3, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x3C, 0xE7, 0x74, 0x40, 0x54, 0xB7, 0x0C,
+        0x00, 0x00, 0x24, 0x87, 0x9F, 0x8F, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'd' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x00, 0x04, 0x80, 0xBF, 0xAF, 0x78, 0xBF, 0x00,
+        0x00, 0x9F, 0xBB, 0x28, 0x28, 0xB3, 0xBF, 0x00,
+        0x14, 0xFF, 0x18, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x38, 0xF3, 0x00, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x14, 0xFF, 0x1C, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x00, 0xA7, 0xC3, 0x44, 0x58, 0xD3, 0xBF, 0x00,
+        0x00, 0x04, 0x78, 0x9F, 0x7C, 0x20, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'e' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x5C, 0xB7, 0xC3, 0x97, 0x14, 0x00,
+        0x00, 0x7C, 0xC3, 0x28, 0x08, 0x7C, 0xC7, 0x00,
+        0x04, 0xF3, 0x48, 0x20, 0x20, 0x20, 0xEB, 0x1C,
+        0x1C, 0xFF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x18,
+        0x00, 0xEB, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x64, 0xDF, 0x58, 0x24, 0x50, 0x78, 0x00,
+        0x00, 0x00, 0x38, 0x93, 0x9F, 0x8B, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'f' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0x68, 0xA7, 0x9F, 0x4C,
+        0x00, 0x00, 0x00, 0x78, 0xC7, 0x34, 0x30, 0x34,
+        0x00, 0x00, 0x00, 0xBF, 0x54, 0x00, 0x00, 0x00,
+        0x00, 0x64, 0x9F, 0xE7, 0xB7, 0x9F, 0x9F, 0x00,
+        0x00, 0x28, 0x40, 0xCF, 0x70, 0x40, 0x40, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'g' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x04, 0x74, 0xC3, 0xB7, 0x9F, 0x9F, 0x50,
+        0x00, 0x70, 0xB7, 0x08, 0x1C, 0xE3, 0x5C, 0x20,
+        0x00, 0x9F, 0x64, 0x00, 0x00, 0xA3, 0x60, 0x00,
+        0x00, 0x54, 0xCF, 0x34, 0x48, 0xE3, 0x20, 0x00,
+        0x00, 0x50, 0x9F, 0x83, 0x78, 0x24, 0x00, 0x00,
+        0x00, 0x8F, 0x97, 0x40, 0x40, 0x40, 0x10, 0x00,
+        0x00, 0x58, 0xB3, 0x9F, 0x9F, 0xA7, 0xEB, 0x54,
+        0x00, 0xEB, 0x04, 0x00, 0x00, 0x00, 0x93, 0x78,
+        0x00, 0xB3, 0xAF, 0x68, 0x68, 0xA3, 0xBF, 0x10,
+        0x00, 0x00, 0x34, 0x60, 0x5C, 0x2C, 0x00, 0x00
+    },
+    /* 'h' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x54, 0x80, 0xC3, 0xAF, 0x28, 0x00,
+        0x00, 0xBF, 0xCF, 0x54, 0x20, 0x8F, 0xC7, 0x00,
+        0x00, 0xBF, 0x64, 0x00, 0x00, 0x24, 0xFB, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0x60, 0x30, 0x00, 0x00, 0x10, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'i' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0x8B, 0x2C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x28, 0xF7, 0x68, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x78, 0x9F, 0x9F, 0x9F, 0x28, 0x00, 0x00,
+        0x00, 0x30, 0x40, 0x40, 0xCF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x60, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'j' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0x8B, 0x2C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x28, 0xF7, 0x68, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x78, 0x9F, 0x9F, 0x9F, 0x28, 0x00, 0x00,
+        0x00, 0x30, 0x40, 0x40, 0xCF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0xE7, 0x34, 0x00, 0x00,
+        0x18, 0xC3, 0x9F, 0xC3, 0xB7, 0x00, 0x00, 0x00,
+        0x00, 0x20, 0x40, 0x34, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'k' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x50, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0x00, 0x34, 0x87, 0x0C,
+        0x00, 0x9F, 0x80, 0x00, 0x3C, 0xDB, 0x28, 0x00,
+        0x00, 0x9F, 0x80, 0x50, 0xDF, 0x28, 0x00, 0x00,
+        0x00, 0x9F, 0xC7, 0xD3, 0xD3, 0x48, 0x00, 0x00,
+        0x00, 0x9F, 0xCB, 0x18, 0x2C, 0xE3, 0x24, 0x00,
+        0x00, 0x9F, 0x80, 0x00, 0x00, 0x5C, 0xCF, 0x0C,
+        0x00, 0x50, 0x40, 0x00, 0x00, 0x00, 0x64, 0x38,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'l' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0x80, 0x80, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x60, 0x60, 0xD7, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBB, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0xBF, 0x40, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0x80, 0x9F, 0x83, 0x0C,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'm' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x28, 0x74, 0x93, 0xBB, 0x38, 0xAF, 0xAF, 0x10,
+        0x40, 0xF7, 0x4C, 0x93, 0xDB, 0x2C, 0xCB, 0x5C,
+        0x40, 0xDF, 0x00, 0x60, 0x9F, 0x00, 0x9F, 0x80,
+        0x40, 0xDF, 0x00, 0x60, 0x9F, 0x00, 0x9F, 0x80,
+        0x40, 0xDF, 0x00, 0x60, 0x9F, 0x00, 0x9F, 0x80,
+        0x40, 0xDF, 0x00, 0x60, 0x9F, 0x00, 0x9F, 0x80,
+        0x20, 0x70, 0x00, 0x30, 0x50, 0x00, 0x50, 0x40,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'n' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x78, 0x24, 0x83, 0xC3, 0xAF, 0x28, 0x00,
+        0x00, 0xBF, 0xCF, 0x54, 0x20, 0x8F, 0xC7, 0x00,
+        0x00, 0xBF, 0x64, 0x00, 0x00, 0x24, 0xFB, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x20, 0xFF, 0x00,
+        0x00, 0x60, 0x30, 0x00, 0x00, 0x10, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'o' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x04, 0x74, 0xBB, 0xBB, 0x74, 0x04, 0x00,
+        0x00, 0x9B, 0xB3, 0x20, 0x20, 0xB3, 0x9B, 0x00,
+        0x14, 0xFF, 0x18, 0x00, 0x00, 0x18, 0xFF, 0x14,
+        0x34, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x34,
+        0x10, 0xFB, 0x24, 0x00, 0x00, 0x24, 0xFB, 0x10,
+        0x00, 0x83, 0xC7, 0x48, 0x48, 0xC7, 0x83, 0x00,
+        0x00, 0x00, 0x50, 0x9B, 0x9B, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'p' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x78, 0x40, 0x97, 0xBF, 0xA3, 0x18, 0x00,
+        0x00, 0xBF, 0xC7, 0x3C, 0x20, 0x97, 0xCB, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x0C, 0xFF, 0x1C,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0xF7, 0x34,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x24, 0xFB, 0x10,
+        0x00, 0xBF, 0xC7, 0x50, 0x48, 0xC7, 0x83, 0x00,
+        0x00, 0xBF, 0x64, 0x87, 0x9F, 0x60, 0x00, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'q' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x04, 0x80, 0xBF, 0xAF, 0x4C, 0x78, 0x00,
+        0x00, 0x9F, 0xBB, 0x28, 0x28, 0xB3, 0xBF, 0x00,
+        0x14, 0xFF, 0x18, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x38, 0xF3, 0x00, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x14, 0xFF, 0x1C, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x00, 0xA7, 0xC3, 0x44, 0x58, 0xD3, 0xBF, 0x00,
+        0x00, 0x04, 0x78, 0x9F, 0x7C, 0x60, 0xBF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x18, 0x00
+    },
+    /* 'r' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x8B, 0x08, 0x7C, 0xC3, 0xBB, 0x0C,
+        0x00, 0x00, 0xEB, 0xB3, 0x74, 0x24, 0x38, 0x00,
+        0x00, 0x00, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 's' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0C, 0x8B, 0xBF, 0xC3, 0x8F, 0x24, 0x00,
+        0x00, 0x8F, 0xA7, 0x08, 0x0C, 0x54, 0x40, 0x00,
+        0x00, 0x78, 0xCB, 0x48, 0x0C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x58, 0xA7, 0xDF, 0xC3, 0x44, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xF3, 0x00,
+        0x00, 0xB3, 0x74, 0x30, 0x24, 0x83, 0xCB, 0x00,
+        0x00, 0x10, 0x6C, 0x9F, 0x9F, 0x7C, 0x10, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 't' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x14, 0x8B, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x20, 0xDF, 0x00, 0x00, 0x00, 0x00,
+        0x14, 0x9F, 0xB7, 0xF3, 0x9F, 0x9F, 0x9F, 0x00,
+        0x08, 0x40, 0x70, 0xE7, 0x40, 0x40, 0x40, 0x00,
+        0x00, 0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0xDF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x3C, 0xE3, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0xEF, 0x6C, 0x2C, 0x4C, 0x0C,
+        0x00, 0x00, 0x00, 0x30, 0x97, 0x9F, 0x87, 0x18,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'u' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0x14, 0x00, 0x00, 0x3C, 0x78, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x60, 0xBF, 0x00,
+        0x00, 0xF7, 0x2C, 0x00, 0x00, 0x6C, 0xBF, 0x00,
+        0x00, 0xBB, 0xAB, 0x40, 0x74, 0xC7, 0xBF, 0x00,
+        0x00, 0x18, 0x8F, 0x9F, 0x60, 0x18, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'v' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x18, 0x93, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x18,
+        0x00, 0xCF, 0x48, 0x00, 0x00, 0x38, 0xCF, 0x00,
+        0x00, 0x5C, 0xB3, 0x00, 0x00, 0xA7, 0x64, 0x00,
+        0x00, 0x04, 0xE7, 0x24, 0x18, 0xE7, 0x08, 0x00,
+        0x00, 0x00, 0x7C, 0x8B, 0x7C, 0x83, 0x00, 0x00,
+        0x00, 0x00, 0x14, 0xE3, 0xDB, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x58, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'w' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x83, 0x2C, 0x00, 0x20, 0x28, 0x00, 0x20, 0x83,
+        0x9F, 0x70, 0x00, 0xAF, 0xC7, 0x00, 0x5C, 0xA3,
+        0x68, 0xAB, 0x00, 0xC7, 0xD3, 0x08, 0x93, 0x68,
+        0x2C, 0xE3, 0x30, 0xAB, 0xA7, 0x40, 0xCF, 0x30,
+        0x00, 0xEF, 0x83, 0x70, 0x68, 0x83, 0xEF, 0x00,
+        0x00, 0xB7, 0xEB, 0x30, 0x28, 0xE7, 0xBB, 0x00,
+        0x00, 0x44, 0x80, 0x00, 0x00, 0x7C, 0x48, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'x' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x70, 0x54, 0x00, 0x00, 0x48, 0x70, 0x00,
+        0x00, 0x20, 0xE3, 0x2C, 0x1C, 0xE3, 0x24, 0x00,
+        0x00, 0x00, 0x50, 0xCF, 0xBB, 0x58, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xDB, 0xD7, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x97, 0x87, 0xA7, 0x83, 0x00, 0x00,
+        0x00, 0x5C, 0xC3, 0x04, 0x0C, 0xD3, 0x54, 0x00,
+        0x04, 0x74, 0x1C, 0x00, 0x00, 0x24, 0x74, 0x04,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'y' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x18, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x87, 0x20,
+        0x00, 0xC7, 0x50, 0x00, 0x00, 0x2C, 0xD7, 0x00,
+        0x00, 0x50, 0xBF, 0x00, 0x00, 0x93, 0x6C, 0x00,
+        0x00, 0x00, 0xCF, 0x38, 0x0C, 0xE7, 0x0C, 0x00,
+        0x00, 0x00, 0x50, 0xAF, 0x64, 0x93, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCB, 0xDB, 0x28, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x70, 0xB7, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xC7, 0x44, 0x00, 0x00, 0x00,
+        0x04, 0xAB, 0xDB, 0x87, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0x20, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* 'z' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x50, 0x9F, 0x9F, 0x9F, 0x9F, 0x9B, 0x00,
+        0x00, 0x20, 0x40, 0x40, 0x54, 0xF3, 0x6C, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0xC3, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xBF, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x04, 0xAB, 0x93, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xE7, 0x64, 0x60, 0x60, 0x60, 0x0C,
+        0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '{' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0x4C, 0x80, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x74, 0x9F, 0x24, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x24, 0x6C, 0xC3, 0x2C, 0x00, 0x00, 0x00,
+        0x00, 0x24, 0x68, 0xC7, 0x2C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x83, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x70, 0xA3, 0x28, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x4C, 0x78, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '|' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00
+    },
+    /* '}' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x50, 0x80, 0x4C, 0x04, 0x00, 0x00, 0x00,
+        0x00, 0x14, 0x24, 0x9F, 0x74, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2C, 0xC3, 0x6C, 0x24, 0x00,
+        0x00, 0x00, 0x00, 0x2C, 0xC7, 0x68, 0x24, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x83, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x14, 0x28, 0xA3, 0x70, 0x00, 0x00, 0x00,
+        0x00, 0x50, 0x78, 0x4C, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    },
+    /* '~' */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x18, 0x8B, 0x70, 0x04, 0x00, 0x64, 0x00,
+        0x00, 0xB7, 0x50, 0x78, 0xC7, 0x9F, 0x83, 0x00,
+        0x00, 0x18, 0x00, 0x00, 0x1C, 0x30, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    }
+};
+
+#endif
@@ -17,10 +17,26 @@
  *  along with img2string.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <stdio.h>
-#include <caca.h>
 #include <getopt.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <math.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "render.h"
+void* limited_malloc(size_t size);
+void* limited_realloc(void* p, size_t size);
+void limited_free(void* p);
+#define STBI_MALLOC(size) limited_malloc(size)
+#define STBI_REALLOC(p, size) limited_realloc(p, size)
+#define STBI_FREE(p) limited_free(p)
+#define STBI_THREADS
 #define STB_IMAGE_IMPLEMENTATION
 #include "extern/stb_image.h"
 #define HELP 1
@@ -30,6 +46,15 @@
 #define DITHER 'd'
 #define ANTIALIAS 'a'
 #define OUTPUT 'o'
+#define THREADS 'j'
+#define COLORS 'c'
+#define SYMBOLS 's'
+#define EXHAUSTIVE 'e'
+#define MAX_PIXELS 2
+#define MAX_MEMORY 3
+
+/* Upper bound for -j, well past any core count. */
+#define MAX_THREADS 4096
 
 enum output_mode
 {
@@ -52,10 +77,43 @@ struct
     float ratio;
     float gamma;
     const char* image;
-    const char* dither;
+    enum dither_algorithm dither;
     int antialias;
     enum output_mode output;
-} options = { 80, 0.5f, 0.5f, NULL, "none", 0, OUTPUT_STDOUT };
+    int threads;
+    enum color_mode colors;
+    enum symbol_mode symbols;
+    int exhaustive;
+    /* Images with more pixels than this are rejected from their header. */
+    unsigned long long max_pixels;
+    /* Cap on the memory the decoder may have allocated at once. */
+    size_t max_memory;
+} options = {
+    80, 0.5f, 0.5f, NULL, DITHER_NONE, 0, OUTPUT_STDOUT, 1, COLOR_MODE_16,
+    SYMBOLS_ASCII, 0, ULLONG_MAX, SIZE_MAX
+};
+
+/* Parses a byte count with an optional K, M or G suffix. Returns non-zero if
+ * str isn't one.
+ */
+int parse_size(const char* str, size_t* size)
+{
+    char* endptr = NULL;
+    unsigned long long value = strtoull(str, &endptr, 10);
+    int shift = 0;
+
+    if(endptr == str || *str == '-') return 1;
+    switch(*endptr)
+    {
+    case 'k': case 'K': shift = 10; endptr++; break;
+    case 'm': case 'M': shift = 20; endptr++; break;
+    case 'g': case 'G': shift = 30; endptr++; break;
+    default: break;
+    }
+    if(*endptr != 0 || value > SIZE_MAX >> shift) return 1;
+    *size = (size_t)value << shift;
+    return 0;
+}
 
 int parse_args(int argc, char** argv)
 {
@@ -69,11 +127,18 @@ int parse_args(int argc, char** argv)
         { "gamma", required_argument, NULL, GAMMA },
         { "dither", required_argument, NULL, DITHER },
         { "antialias", no_argument, &options.antialias, ANTIALIAS },
-        { "output", required_argument, NULL, OUTPUT }
+        { "output", required_argument, NULL, OUTPUT },
+        { "threads", required_argument, NULL, THREADS },
+        { "colors", required_argument, NULL, COLORS },
+        { "symbols", required_argument, NULL, SYMBOLS },
+        { "exhaustive", no_argument, &options.exhaustive, EXHAUSTIVE },
+        { "max-pixels", required_argument, NULL, MAX_PIXELS },
+        { "max-memory", required_argument, NULL, MAX_MEMORY },
+        { NULL, 0, NULL, 0 }
     };
 
     int val = 0;
-    while((val = getopt_long(argc, argv, "w:r:g:d:ao:", longopts, &indexptr)) != -1)
+    while((val = getopt_long(argc, argv, "w:r:g:d:ao:j:c:s:e", longopts, &indexptr)) != -1)
     {
         switch(val)
         {
@@ -105,22 +170,28 @@ int parse_args(int argc, char** argv)
             }
             break;
         case DITHER:
-            if(
-                strcmp(optarg, "none") != 0 &&
-                strcmp(optarg, "ordered2") != 0 &&
-                strcmp(optarg, "ordered4") != 0 &&
-                strcmp(optarg, "ordered8") != 0 &&
-                strcmp(optarg, "random") != 0 &&
-                strcmp(optarg, "fstein") != 0
-            ) {
+            if(!strcmp(optarg, "none")) options.dither = DITHER_NONE;
+            else if(!strcmp(optarg, "ordered2"))
+                options.dither = DITHER_ORDERED2;
+            else if(!strcmp(optarg, "ordered4"))
+                options.dither = DITHER_ORDERED4;
+            else if(!strcmp(optarg, "ordered8"))
+                options.dither = DITHER_ORDERED8;
+            else if(!strcmp(optarg, "random")) options.dither = DITHER_RANDOM;
+            else if(!strcmp(optarg, "bluenoise"))
+                options.dither = DITHER_BLUENOISE;
+            else if(!strcmp(optarg, "fstein")) options.dither = DITHER_FSTEIN;
+            else {
                 printf("Unknown dither %s\n", optarg);
                 goto help_print;
             }
-            options.dither = optarg;
             break;
         case ANTIALIAS:
             options.antialias = 1;
             break;
+        case EXHAUSTIVE:
+            options.exhaustive = 1;
+            break;
         case OUTPUT:
             if(!strcmp(optarg, "s") || !strcmp(optarg, "stdout"))
                 options.output = OUTPUT_STDOUT;
@@ -136,6 +207,63 @@ int parse_args(int argc, char** argv)
                 goto help_print;
             }
             break;
+        case THREADS:
+        {
+            long threads = strtol(optarg, &endptr, 10);
+
+            if(
+                *endptr != 0 || endptr == optarg ||
+                threads < 0 || threads > MAX_THREADS
+            ){
+                printf("Thread count must be a non-negative integer\n");
+                goto help_print;
+            }
+            /* 0 is one per core, or 1 if the count can't be queried. */
+            if(threads == 0) threads = sysconf(_SC_NPROCESSORS_ONLN);
+            if(threads < 1) threads = 1;
+            if(threads > MAX_THREADS) threads = MAX_THREADS;
+            options.threads = threads;
+            break;
+        }
+        case COLORS:
+            if(!strcmp(optarg, "16")) options.colors = COLOR_MODE_16;
+            else if(!strcmp(optarg, "256")) options.colors = COLOR_MODE_256;
+            else if(!strcmp(optarg, "24bit") || !strcmp(optarg, "truecolor"))
+                options.colors = COLOR_MODE_24BIT;
+            else {
+                printf("Unknown color mode %s\n", optarg);
+                goto help_print;
+            }
+            break;
+        case SYMBOLS:
+            if(!strcmp(optarg, "ascii")) options.symbols = SYMBOLS_ASCII;
+            else if(!strcmp(optarg, "half")) options.symbols = SYMBOLS_HALF;
+            else if(!strcmp(optarg, "braille"))
+                options.symbols = SYMBOLS_BRAILLE;
+            else if(!strcmp(optarg, "sextant"))
+                options.symbols = SYMBOLS_SEXTANT;
+            else if(!strcmp(optarg, "shapes")) options.symbols = SYMBOLS_SHAPES;
+            else {
+                printf("Unknown symbol set %s\n", optarg);
+                goto help_print;
+            }
+            break;
+        case MAX_PIXELS:
+            options.max_pixels = strtoull(optarg, &endptr, 10);
+
+            if(*endptr != 0 || *optarg == '-')
+            {
+                printf("Pixel limit must be a positive integer\n");
+                goto help_print;
+            }
+            break;
+        case MAX_MEMORY:
+            if(parse_size(optarg, &options.max_memory))
+            {
+                printf("Memory limit must be a size in bytes\n");
+                goto help_print;
+            }
+            break;
         case HELP:
             goto help_print;
         default: break;
@@ -153,13 +281,15 @@ int parse_args(int argc, char** argv)
 help_print:
     printf(
         "Usage: %s [-w width] [-g gamma] [-d dither] [-r pixelratio] "
-        "[-o mode] [-a] image\n"
+        "[-o mode] [-c colors] [-s symbols] [-j threads] [-a] [-e] "
+        "[--max-pixels pixels] [--max-memory bytes] image\n"
         "\ndither can be one of the following:\n"
         "\tnone (default)\n"
         "\tordered2\n"
         "\tordered4\n"
         "\tordered8\n"
         "\trandom\n"
+        "\tbluenoise\n"
         "\tfstein\n"
         "\npixelratio is the aspect ratio of a pixel.\n"
         "\nmode is the output mode. It can be one of the following:\n"
@@ -168,71 +298,234 @@ help_print:
         "\tpy\tOutputs a Python string.\n"
         "\tjs\tOutputs a Javascript (node.js compatible) string.\n"
         "\tsh\tOutputs a Bash string.\n"
-        "\n-a enables antialiasing.\n",
+        "\ncolors is the color mode. It can be one of the following:\n"
+        "\t16   \tThe 16 ANSI colors. (default)\n"
+        "\t256  \tThe xterm 256-color palette.\n"
+        "\t24bit\t24-bit truecolor, not dithered.\n"
+        "\nsymbols is the character set. It can be one of the following:\n"
+        "\tascii  \tASCII characters. (default)\n"
+        "\thalf   \tUnicode half blocks, two pixels per character.\n"
+        "\tbraille\tBraille patterns, 2x4 pixels per character.\n"
+        "\tsextant\tUnicode 13 sextants, 2x3 pixels per character.\n"
+        "\tshapes \tASCII characters matched to the shapes in the image.\n"
+        "\nthreads is the number of decoding and rendering threads, 0 uses "
+        "all cores.\n"
+        "\nimage can be - to read it from the standard input.\n"
+        "\n-a enables antialiasing.\n"
+        "\n-e tries every foreground/background pair for each character in "
+        "16-color mode.\n"
+        "\n--max-pixels rejects larger images before decoding them.\n"
+        "\n--max-memory caps the memory the decoder may use, e.g. 512M.\n",
         argv[0]
     );
 return 1;
 }
 
-int caca_to_ansi(enum caca_color color)
+int color_to_ansi(uint32_t color)
 {
     switch(color)
     {
-    case CACA_BLACK: return 30;
-    case CACA_BLUE: return 34;
-    case CACA_GREEN: return 32;
-    case CACA_CYAN: return 36;
-    case CACA_RED: return 31;
-    case CACA_MAGENTA: return 35;
-    case CACA_BROWN: return 33;
-    case CACA_LIGHTGRAY: return 37;
-    case CACA_DARKGRAY: return 90;
-    case CACA_LIGHTBLUE: return 94;
-    case CACA_LIGHTGREEN: return 92;
-    case CACA_LIGHTCYAN: return 96;
-    case CACA_LIGHTRED: return 91;
-    case CACA_LIGHTMAGENTA: return 95;
-    case CACA_YELLOW: return 93;
-    case CACA_WHITE: return 97;
-    case CACA_DEFAULT: return 0;
+    case COLOR_BLACK: return 30;
+    case COLOR_BLUE: return 34;
+    case COLOR_GREEN: return 32;
+    case COLOR_CYAN: return 36;
+    case COLOR_RED: return 31;
+    case COLOR_MAGENTA: return 35;
+    case COLOR_BROWN: return 33;
+    case COLOR_LIGHTGRAY: return 37;
+    case COLOR_DARKGRAY: return 90;
+    case COLOR_LIGHTBLUE: return 94;
+    case COLOR_LIGHTGREEN: return 92;
+    case COLOR_LIGHTCYAN: return 96;
+    case COLOR_LIGHTRED: return 91;
+    case COLOR_LIGHTMAGENTA: return 95;
+    case COLOR_YELLOW: return 93;
+    case COLOR_WHITE: return 97;
     default:
-    case CACA_TRANSPARENT: return 0;
+    case COLOR_TRANSPARENT: return 0;
     };
 }
 
 #define nop
 
-#define output_canvas_pixels(cv, pre, post, reset, line_start, line_end, output, set_fg, set_both) { \
-    int w = caca_get_canvas_width(cv); \
-    int h = caca_get_canvas_height(cv); \
-    pre;\
+/* Writes the SGR parameters selecting the color into buf, which must have
+ * room for at least SGR_MAX_LEN characters.
+ */
+#define SGR_MAX_LEN 20
+void color_to_sgr(
+    char* buf, uint32_t color, int background, enum color_mode mode
+){
+    static const char digit_pairs[] =
+        "00010203040506070809101112131415161718192021222324"
+        "25262728293031323334353637383940414243444546474849"
+        "50515253545556575859606162636465666768697071727374"
+        "75767778798081828384858687888990919293949596979899";
+    unsigned values[3];
+    int count = 0;
+
+    if(mode == COLOR_MODE_256)
+    {
+        memcpy(buf, background ? "48;5;" : "38;5;", 5);
+        buf += 5;
+        values[0] = color;
+        count = 1;
+    }
+    else if(mode == COLOR_MODE_24BIT)
+    {
+        memcpy(buf, background ? "48;2;" : "38;2;", 5);
+        buf += 5;
+        values[0] = (color >> 16) & 0xFF;
+        values[1] = (color >> 8) & 0xFF;
+        values[2] = color & 0xFF;
+        count = 3;
+    }
+    else
+    {
+        values[0] = color_to_ansi(color) + (background ? 10 : 0);
+        count = 1;
+    }
+
+    for(int i = 0; i < count; ++i)
+    {
+        unsigned v = values[i];
+        if(i != 0) *buf++ = ';';
+        if(v >= 100)
+        {
+            *buf++ = '0' + v / 100;
+            v %= 100;
+            memcpy(buf, digit_pairs + 2 * v, 2);
+            buf += 2;
+        }
+        else if(v >= 10)
+        {
+            memcpy(buf, digit_pairs + 2 * v, 2);
+            buf += 2;
+        }
+        else *buf++ = '0' + v;
+    }
+    *buf = 0;
+}
+
+/* Prints an SGR escape sequence with one or two parameter strings. */
+void print_sgr(const char* esc, const char* a, const char* b)
+{
+    fputs(esc, stdout);
+    fputs(a, stdout);
+    if(b)
+    {
+        putchar(';');
+        fputs(b, stdout);
+    }
+    putchar('m');
+}
+
+/* Writes the UTF-8 encoding of the code point into buf, which must have room
+ * for 4 bytes, and returns its length.
+ */
+int encode_utf8(char* buf, uint32_t ch)
+{
+    if(ch < 0x80)
+    {
+        buf[0] = ch;
+        return 1;
+    }
+    if(ch < 0x800)
+    {
+        buf[0] = 0xC0 | (ch >> 6);
+        buf[1] = 0x80 | (ch & 0x3F);
+        return 2;
+    }
+    if(ch < 0x10000)
+    {
+        buf[0] = 0xE0 | (ch >> 12);
+        buf[1] = 0x80 | ((ch >> 6) & 0x3F);
+        buf[2] = 0x80 | (ch & 0x3F);
+        return 3;
+    }
+    buf[0] = 0xF0 | (ch >> 18);
+    buf[1] = 0x80 | ((ch >> 12) & 0x3F);
+    buf[2] = 0x80 | ((ch >> 6) & 0x3F);
+    buf[3] = 0x80 | (ch & 0x3F);
+    return 4;
+}
+
+/* The UTF-8 encodings of every glyph the canvas can hold, built once for the
+ * symbol set before anything is printed. ASCII glyphs are indexed by their
+ * code point and the rest by their lowest byte, which symbol_glyphs keeps
+ * unique.
+ */
+struct utf8_glyph
+{
+    int len;
+    char bytes[4];
+};
+static struct utf8_glyph utf8_ascii[0x80];
+static struct utf8_glyph utf8_glyphs[256];
+
+void init_utf8_glyphs(enum symbol_mode symbols)
+{
+    uint32_t glyphs[256];
+    int count = symbol_glyphs(symbols, glyphs);
+
+    for(uint32_t ch = 0; ch < 0x80; ++ch)
+        utf8_ascii[ch].len = encode_utf8(utf8_ascii[ch].bytes, ch);
+    for(int i = 0; i < count; ++i)
+    {
+        struct utf8_glyph* g = utf8_glyphs + (glyphs[i] & 0xFF);
+        g->len = encode_utf8(g->bytes, glyphs[i]);
+    }
+}
+
+const struct utf8_glyph* glyph_to_utf8(uint32_t ch)
+{
+    return ch < 0x80 ? utf8_ascii + ch : utf8_glyphs + (ch & 0xFF);
+}
+
+/* The canvas may arrive in bands, so pre is only printed before the first
+ * one and post after the last one.
+ */
+#define output_canvas_pixels(cv, pre, post, reset, line_start, line_end, output, set_attr, set_both) { \
+    int w = cv->width; \
+    int h = cv->height; \
+    char fg_sgr[SGR_MAX_LEN]; \
+    char bg_sgr[SGR_MAX_LEN]; \
+    if(first) { pre; } \
     for(int y= 0; y < h; ++y) { \
-        uint32_t prev_a = 0; \
+        const struct cell* row = cv->cells + (size_t)y * w; \
+        uint32_t prev_fg = COLOR_TRANSPARENT; \
+        uint32_t prev_bg = COLOR_TRANSPARENT; \
         line_start; \
         for(int x = 0; x < w; ++x) { \
-            char c = caca_get_char(cv, x, y); \
-            uint32_t a = caca_get_attr(cv, x, y); \
-            if(a != prev_a) { \
-                uint8_t fg = caca_attr_to_ansi_fg(a); \
-                uint8_t bg = caca_attr_to_ansi_bg(a); \
-                if(bg == CACA_TRANSPARENT) { \
+            const struct utf8_glyph* glyph = glyph_to_utf8(row[x].ch); \
+            uint32_t fg = row[x].fg; \
+            uint32_t bg = row[x].bg; \
+            if(fg != prev_fg || bg != prev_bg) { \
+                color_to_sgr(fg_sgr, fg, 0, cv->colors); \
+                color_to_sgr(bg_sgr, bg, 1, cv->colors); \
+                if(bg == COLOR_TRANSPARENT) { \
                     reset; \
-                    if(fg != CACA_TRANSPARENT) set_fg(caca_to_ansi(fg)); \
-                } else set_both(caca_to_ansi(fg), caca_to_ansi(bg)+10); \
+                    if(fg != COLOR_TRANSPARENT) set_attr(fg_sgr); \
+                } else if(fg == COLOR_TRANSPARENT) { \
+                    if(prev_fg != COLOR_TRANSPARENT) reset; \
+                    set_attr(bg_sgr); \
+                } else set_both(fg_sgr, bg_sgr); \
             } \
-            output(c); \
-            prev_a = a; \
+            for(int i = 0; i < glyph->len; ++i) output(glyph->bytes[i]); \
+            prev_fg = fg; \
+            prev_bg = bg; \
         } \
         reset; \
         line_end; \
     } \
-    post; \
+    if(last) { post; } \
 }
 
-#define stdout_fg(fg) printf("\x1b[%dm", fg)
-#define stdout_both(fg, bg) printf("\x1b[%d;%dm", fg, bg)
+#define stdout_attr(a) print_sgr("\x1b[", a, NULL)
+#define stdout_both(fg, bg) print_sgr("\x1b[", fg, bg)
 
-void print_canvas_stdout(caca_canvas_t* cv) output_canvas_pixels(
+void print_canvas_stdout(
+    const struct canvas* cv, int first, int last
+) output_canvas_pixels(
     cv,
     printf("\x1b[0m"),
     nop,
@@ -240,7 +533,7 @@ void print_canvas_stdout(caca_canvas_t* cv) output_canvas_pixels(
     nop,
     printf("\x1b[0m\n"),
     putchar,
-    stdout_fg,
+    stdout_attr,
     stdout_both
 );
 
@@ -260,10 +553,12 @@ void print_escaped_char(char c)
     }
 }
 
-#define stringout_fg(fg) printf("\\x1b[%dm", fg)
-#define stringout_both(fg, bg) printf("\\x1b[%d;%dm", fg, bg)
+#define stringout_attr(a) print_sgr("\\x1b[", a, NULL)
+#define stringout_both(fg, bg) print_sgr("\\x1b[", fg, bg)
 
-void print_canvas_c(caca_canvas_t* cv) output_canvas_pixels(
+void print_canvas_c(
+    const struct canvas* cv, int first, int last
+) output_canvas_pixels(
     cv,
     printf("const char* image = \"\\x1b[0m"),
     printf("\";\n");,
@@ -271,11 +566,13 @@ void print_canvas_c(caca_canvas_t* cv) output_canvas_pixels(
     nop,
     printf("\\x1b[0m\\n"),
     print_escaped_char,
-    stringout_fg,
+    stringout_attr,
     stringout_both
 );
 
-void print_canvas_python(caca_canvas_t* cv) output_canvas_pixels(
+void print_canvas_python(
+    const struct canvas* cv, int first, int last
+) output_canvas_pixels(
     cv,
     printf("image = \"\"\"\\x1b[0m"),
     printf("\"\"\"\n");,
@@ -283,11 +580,13 @@ void print_canvas_python(caca_canvas_t* cv) output_canvas_pixels(
     nop,
     printf("\\x1b[0m\n"),
     print_escaped_char,
-    stringout_fg,
+    stringout_attr,
     stringout_both
 );
 
-void print_canvas_javascript(caca_canvas_t* cv) output_canvas_pixels(
+void print_canvas_javascript(
+    const struct canvas* cv, int first, int last
+) output_canvas_pixels(
     cv,
     printf("const image = \'\\x1b[0m"),
     printf("\';\n");,
@@ -295,7 +594,7 @@ void print_canvas_javascript(caca_canvas_t* cv) output_canvas_pixels(
     nop,
     printf("\\x1b[0m\\n"),
     print_escaped_char,
-    stringout_fg,
+    stringout_attr,
     stringout_both
 );
 
@@ -316,10 +615,12 @@ void print_escaped_char_bash(char c)
     }
 }
 
-#define bash_fg(fg) printf("\\033[%dm", fg)
-#define bash_both(fg, bg) printf("\\033[%d;%dm", fg, bg)
+#define bash_attr(a) print_sgr("\\033[", a, NULL)
+#define bash_both(fg, bg) print_sgr("\\033[", fg, bg)
 
-void print_canvas_bash(caca_canvas_t* cv) output_canvas_pixels(
+void print_canvas_bash(
+    const struct canvas* cv, int first, int last
+) output_canvas_pixels(
     cv,
     printf("IMAGE=\"\\033[0m"),
     printf("\"\n");,
@@ -327,78 +628,416 @@ void print_canvas_bash(caca_canvas_t* cv) output_canvas_pixels(
     nop,
     printf("\\033[0m\\n"),
     print_escaped_char_bash,
-    bash_fg,
+    bash_attr,
     bash_both
 );
 
-int main(int argc, char** argv)
+void print_canvas(const struct canvas* cv, int first, int last)
 {
-    int ret = 0;
-    if((ret = parse_args(argc, argv))) return ret;
-
-    int in_w, in_h;
-    int n;
-
-    unsigned char* input_data = stbi_load(options.image, &in_w, &in_h, &n, 4);
-
-    if(!input_data)
-    {
-        printf("Failed to load image %s\n", options.image);
-        return 1;
-    }
-
-    int height = (int)round(options.width*options.ratio*in_h/in_w);
-
-    caca_canvas_t* canvas = caca_create_canvas(options.width, height);
-    caca_set_color_ansi(canvas, CACA_TRANSPARENT, CACA_TRANSPARENT);
-    caca_clear_canvas(canvas);
-    caca_dither_t* dither = caca_create_dither(
-        32,
-        in_w,
-        in_h,
-        4 * in_w,
-        0x000000FF,
-        0x0000FF00,
-        0x00FF0000,
-        0xFF000000
-    );
-    caca_set_dither_gamma(dither, options.gamma);
-    caca_set_dither_algorithm(dither, options.dither);
-    caca_set_dither_antialias(dither, options.antialias ? "prefilter" : "none");
-
-    caca_dither_bitmap(
-        canvas,
-        0,
-        0,
-        options.width,
-        height,
-        dither,
-        input_data
-    );
-
     switch(options.output)
     {
     case OUTPUT_STDOUT:
-        print_canvas_stdout(canvas);
+        print_canvas_stdout(cv, first, last);
         break;
     case OUTPUT_C:
-        print_canvas_c(canvas);
+        print_canvas_c(cv, first, last);
         break;
     case OUTPUT_PYTHON:
-        print_canvas_python(canvas);
+        print_canvas_python(cv, first, last);
         break;
     case OUTPUT_JAVASCRIPT:
-        print_canvas_javascript(canvas);
+        print_canvas_javascript(cv, first, last);
         break;
     case OUTPUT_BASH:
-        print_canvas_bash(canvas);
+        print_canvas_bash(cv, first, last);
         break;
     }
+}
+
+/* The formats of 8-bit pixels with 1 to 4 channels, in RGB or BGR order. */
+static const enum pixel_format channel_formats[2][5] = {
+    { PIXEL_RGBA, PIXEL_GRAY, PIXEL_GRAY_ALPHA, PIXEL_RGB, PIXEL_RGBA },
+    { PIXEL_RGBA, PIXEL_GRAY, PIXEL_GRAY_ALPHA, PIXEL_BGR, PIXEL_BGRA }
+};
+
+/* The image is decoded a few rows at a time, and every band of the canvas is
+ * printed as soon as the rows under it have been rendered.
+ */
+struct stream_state
+{
+    const struct render_options* opt;
+    int height;
+    struct render_stream* stream;
+    int failed;
+    /* Whether the first and the last band have been printed. */
+    int started, finished;
+};
+
+int emit_band(void* user, const struct canvas* band, int y)
+{
+    struct stream_state* st = user;
+    st->started = 1;
+    st->finished = y + band->height == st->height;
+    print_canvas(band, y == 0, st->finished);
+    fflush(stdout);
+    return 0;
+}
+
+int stream_size(void* user, int x, int y, int comp)
+{
+    struct stream_state* st = user;
+    st->stream = create_render_stream(
+        options.width, st->height, x, y, channel_formats[0][comp],
+        st->opt, emit_band, st
+    );
+    st->failed = !st->stream;
+    return !st->failed;
+}
+
+int stream_rows(void* user, stbi_uc* data, int y, int count)
+{
+    struct stream_state* st = user;
+    st->failed = render_stream_rows(st->stream, data, y, count);
+    return !st->failed;
+}
+
+/* The input file, mapped into memory. */
+struct mapping
+{
+    unsigned char* data;
+    size_t size;
+};
+
+/* Returns non-zero if the file can't be mapped, e.g. because it isn't a
+ * regular file or is too large for stb_image to take from memory.
+ */
+int map_file(const char* path, struct mapping* m)
+{
+    struct stat st;
+    int fd = strcmp(path, "-") ? open(path, O_RDONLY) : dup(STDIN_FILENO);
+    if(fd < 0) return 1;
+    if(
+        fstat(fd, &st) || !S_ISREG(st.st_mode) ||
+        st.st_size == 0 || st.st_size > INT_MAX
+    ){
+        close(fd);
+        return 1;
+    }
+    void* data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(data == MAP_FAILED) return 1;
+    /* Every decoder reads the file front to back. */
+    madvise(data, st.st_size, MADV_SEQUENTIAL);
+    m->data = data;
+    m->size = st.st_size;
+    return 0;
+}
+
+/* Every block the decoder allocates is prefixed with its size, so that the
+ * total can be kept under options.max_memory.
+ */
+union block_header
+{
+    size_t size;
+    max_align_t align;
+};
+
+atomic_size_t decoder_memory = 0;
+atomic_int decoder_memory_exceeded = 0;
+
+void* limited_realloc(void* p, size_t size)
+{
+    union block_header* block = p ? (union block_header*)p - 1 : NULL;
+    size_t old_size = block ? block->size : 0;
+
+    if(size > SIZE_MAX - sizeof(*block)) return NULL;
+
+    /* The old block is only released after the new one is allocated. */
+    size_t used = atomic_fetch_add(&decoder_memory, size) + size;
+    if(used - old_size > options.max_memory)
+    {
+        atomic_fetch_sub(&decoder_memory, size);
+        decoder_memory_exceeded = 1;
+        return NULL;
+    }
 
-    caca_free_dither(dither);
-    caca_free_canvas(canvas);
+    union block_header* resized = realloc(block, sizeof(*block) + size);
+    if(!resized)
+    {
+        atomic_fetch_sub(&decoder_memory, size);
+        return NULL;
+    }
+    atomic_fetch_sub(&decoder_memory, old_size);
+    resized->size = size;
+    return resized + 1;
+}
 
-    stbi_image_free(input_data);
+void* limited_malloc(size_t size)
+{
+    return limited_realloc(NULL, size);
+}
 
+void limited_free(void* p)
+{
+    if(!p) return;
+    union block_header* block = (union block_header*)p - 1;
+    atomic_fetch_sub(&decoder_memory, block->size);
+    free(block);
+}
+
+void print_memory_exceeded(void)
+{
+    fprintf(
+        stderr, "Image %s needs more than %zu bytes of memory\n",
+        options.image, options.max_memory
+    );
+}
+
+/* Standard input when it can't be mapped, e.g. a pipe. A pipe can't be
+ * rewound, so the bytes read while probing the header are kept and replayed
+ * to the decoder, which then reads the rest straight from the pipe.
+ */
+struct pipe_input
+{
+    unsigned char* data;
+    size_t size;
+    size_t capacity;
+    size_t pos;
+    int replay;
+};
+
+int pipe_read(void* user, char* data, int size)
+{
+    struct pipe_input* in = user;
+    if(in->pos == in->size)
+    {
+        if(in->replay) return fread(data, 1, size, stdin);
+
+        if(in->size + size > in->capacity)
+        {
+            size_t capacity = in->capacity ? in->capacity : 4096;
+            while(capacity < in->size + size) capacity *= 2;
+            unsigned char* grown = realloc(in->data, capacity);
+            if(!grown) return 0;
+            in->data = grown;
+            in->capacity = capacity;
+        }
+        in->size += fread(in->data + in->size, 1, size, stdin);
+    }
+
+    size_t n = in->size - in->pos;
+    if(n > (size_t)size) n = size;
+    memcpy(data, in->data + in->pos, n);
+    in->pos += n;
+    return n;
+}
+
+void pipe_skip(void* user, int n)
+{
+    char discard[4096];
+    while(n > 0)
+    {
+        int read = pipe_read(
+            user, discard, n < (int)sizeof(discard) ? n : (int)sizeof(discard)
+        );
+        if(read == 0) break;
+        n -= read;
+    }
+}
+
+int pipe_eof(void* user)
+{
+    struct pipe_input* in = user;
+    return in->pos == in->size && (feof(stdin) || ferror(stdin));
+}
+
+const stbi_io_callbacks pipe_callbacks = { pipe_read, pipe_skip, pipe_eof };
+
+/* Renders an image with uncompressed pixels straight from the mapping,
+ * without decoding a copy of it.
+ */
+int render_raw(
+    const stbi_raw_layout* raw,
+    int height,
+    const struct render_options* opt
+){
+    struct image image = {
+        raw->data, raw->x, raw->y,
+        channel_formats[raw->bgr][raw->channels], raw->stride
+    };
+    struct canvas* canvas = create_canvas(options.width, height);
+
+    if(!canvas || render_image(canvas, &image, opt))
+    {
+        fprintf(stderr, "Failed to allocate the canvas\n");
+        free_canvas(canvas);
+        return 1;
+    }
+    print_canvas(canvas, 1, 1);
+    free_canvas(canvas);
+    return 0;
+}
+
+/* Decodes the image a few rows at a time from the mapping, from the pipe if
+ * pipe is non-NULL, or else from the file, printing the canvas band by band.
+ */
+int render_decoded(
+    const struct mapping* file,
+    struct pipe_input* pipe,
+    int height,
+    const struct render_options* opt
+){
+    struct stream_state st = { opt, height, NULL, 0, 0, 0 };
+    stbi_row_callbacks callbacks = { stream_size, stream_rows };
+    int loaded;
+
+    /* Images the decoder has to load whole are checked against the limit
+     * before any of it is decoded, from the size in their header.
+     */
+    if(options.max_memory != SIZE_MAX)
+    {
+        int w, h, n, whole;
+        if(file->data)
+            whole = stbi_info_whole_from_memory(
+                file->data, (int)file->size, &w, &h, &n
+            );
+        else if(pipe)
+        {
+            pipe->pos = 0;
+            whole = stbi_info_whole_from_callbacks(
+                &pipe_callbacks, pipe, &w, &h, &n
+            );
+        }
+        else whole = stbi_info_whole(options.image, &w, &h, &n);
+        if(whole && (unsigned long long)w * h * n > options.max_memory)
+        {
+            print_memory_exceeded();
+            return 1;
+        }
+    }
+
+    /* The rows come with as many channels as the image has, which the
+     * renderer takes as they are, instead of having them expanded to RGBA.
+     */
+    if(file->data)
+        loaded = stbi_load_rows_from_memory(
+            file->data, (int)file->size, &callbacks, &st, 0
+        );
+    else if(pipe)
+    {
+        pipe->pos = 0;
+        pipe->replay = 1;
+        loaded = stbi_load_rows_from_callbacks(
+            &pipe_callbacks, pipe, &callbacks, &st, 0
+        );
+    }
+    else loaded = stbi_load_rows(options.image, &callbacks, &st, 0);
+    free_render_stream(st.stream);
+
+    if((st.failed || !loaded) && st.started && !st.finished)
+    {
+        /* The bands printed so far stay, but are closed like a whole image,
+         * so that the output is still a valid string.
+         */
+        struct canvas empty = { options.width, 0, options.colors, NULL };
+        print_canvas(&empty, 0, 1);
+    }
+    if(st.failed)
+    {
+        fprintf(stderr, "Failed to allocate the canvas\n");
+        return 1;
+    }
+    if(!loaded)
+    {
+        if(decoder_memory_exceeded) print_memory_exceeded();
+        else fprintf(stderr, "Failed to load image %s\n", options.image);
+        return 1;
+    }
+
+    if(height == 0)
+    {
+        /* No bands were emitted, but the output is still a valid string. */
+        struct canvas empty = { options.width, 0, options.colors, NULL };
+        print_canvas(&empty, 1, 1);
+    }
     return 0;
 }
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+    if((ret = parse_args(argc, argv))) return ret;
+    init_utf8_glyphs(options.symbols);
+
+    int in_w, in_h;
+    int n;
+
+    struct render_options render_opts = {
+        options.gamma,
+        options.dither,
+        options.colors,
+        options.symbols,
+        options.antialias,
+        options.exhaustive,
+        options.threads
+    };
+
+    struct mapping file = { NULL, 0 };
+    struct pipe_input stdin_pipe = { NULL, 0, 0, 0, 0 };
+    struct pipe_input* pipe = NULL;
+    int found;
+    if(!map_file(options.image, &file))
+        found = stbi_info_from_memory(
+            file.data, (int)file.size, &in_w, &in_h, &n
+        );
+    else if(!strcmp(options.image, "-"))
+    {
+        pipe = &stdin_pipe;
+        found = stbi_info_from_callbacks(
+            &pipe_callbacks, pipe, &in_w, &in_h, &n
+        );
+    }
+    else found = stbi_info(options.image, &in_w, &in_h, &n);
+
+    /* Nothing has been allocated for the image yet, so oversized ones cost
+     * no more than reading their header.
+     */
+    if(!found)
+    {
+        /* Even probing the header allocates a little, for JPEGs and GIFs. */
+        if(decoder_memory_exceeded) print_memory_exceeded();
+        else fprintf(stderr, "Failed to load image %s\n", options.image);
+        ret = 1;
+        goto end;
+    }
+    if((unsigned long long)in_w * in_h > options.max_pixels)
+    {
+        fprintf(
+            stderr, "Image %s has more than %llu pixels (%dx%d)\n",
+            options.image, options.max_pixels, in_w, in_h
+        );
+        ret = 1;
+        goto end;
+    }
+
+    int height = (int)round(options.width*options.ratio*in_h/in_w);
+
+    /* Lets JPEGs skip most of the decoding work when the canvas is small. */
+    int sample_w, sample_h;
+    render_resolution(options.width, height, &render_opts, &sample_w, &sample_h);
+    stbi_set_min_size_on_load_thread(sample_w, sample_h);
+    /* The same threads can decode JPEGs with restart markers in parallel. */
+    stbi_set_threads_on_load_thread(options.threads);
+
+    stbi_raw_layout raw;
+    if(
+        file.data &&
+        stbi_raw_layout_from_memory(file.data, (int)file.size, &raw)
+    ) ret = render_raw(&raw, height, &render_opts);
+    else ret = render_decoded(&file, pipe, height, &render_opts);
+
+end:
+    if(file.data) munmap(file.data, file.size);
+    free(stdin_pipe.data);
+    return ret;
+}
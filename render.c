@@ -0,0 +1,2210 @@
+/*
+ *  Copyright 2018 Julius Ikkala
+ *
+ *  This file is part of img2string.
+ *
+ *  img2string is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  img2string is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with img2string.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "render.h"
+#include "glyph_atlas.h"
+#include "bluenoise.h"
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* SSE2 is part of the x86-64 baseline, so only the AVX2 kernels need runtime
+ * detection.
+ */
+#if defined(__GNUC__) && defined(__x86_64__)
+#define RENDER_X86
+#include <immintrin.h>
+#endif
+
+/* Like libcaca, all color math is done with 12-bit channels. */
+#define CHANNEL_MAX 0xFFF
+#define ALPHA_THRESHOLD 0x800
+
+/* Dithered samples are clamped to this range so that the differences to
+ * palette colors always fit in 16 bits.
+ */
+#define SAMPLE_MIN (-0x1000)
+#define SAMPLE_MAX 0x1FFF
+
+static const int palette_rgb[16][3] = {
+    { 0x000, 0x000, 0x000 },
+    { 0x000, 0x000, 0x7FF },
+    { 0x000, 0x7FF, 0x000 },
+    { 0x000, 0x7FF, 0x7FF },
+    { 0x7FF, 0x000, 0x000 },
+    { 0x7FF, 0x000, 0x7FF },
+    { 0x7FF, 0x7FF, 0x000 },
+    { 0xAAA, 0xAAA, 0xAAA },
+    { 0x555, 0x555, 0x555 },
+    { 0x000, 0x000, 0xFFF },
+    { 0x000, 0xFFF, 0x000 },
+    { 0x000, 0xFFF, 0xFFF },
+    { 0xFFF, 0x000, 0x000 },
+    { 0xFFF, 0x000, 0xFFF },
+    { 0xFFF, 0xFFF, 0x000 },
+    { 0xFFF, 0xFFF, 0xFFF }
+};
+
+/* Grays are penalized so that they don't swallow the saturated colors. */
+static const int palette_weight[16] = {
+    2, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 2
+};
+
+/* Ordered by coverage. The last glyph is never picked, it only widens the
+ * blending steps between the foreground and background color.
+ */
+static const uint32_t glyphs[] = {
+    ' ', '.', ':', ';', 't', '%', 'S', 'X', '@', '8', '?'
+};
+#define GLYPH_COUNT (int)(sizeof(glyphs)/sizeof(*glyphs))
+#define GLYPH_STEPS (2 * GLYPH_COUNT - 1)
+
+/* Glyphs of the sub-cell symbol sets, indexed by a mask of the set samples
+ * in row-major order.
+ */
+static uint32_t braille_glyphs[256];
+static uint32_t sextant_glyphs[64];
+
+/* The glyph atlas widened for _mm_madd_epi16(), with the sum of each glyph
+ * and the reciprocal of SHAPE_PIXELS^2 times its variance, or 0 if it has
+ * none. With those, the correlation between a block and a glyph only needs
+ * their dot product.
+ */
+#define SHAPE_PIXELS (GLYPH_ATLAS_WIDTH * GLYPH_ATLAS_HEIGHT)
+/* Padded with empty glyphs to a multiple of 4, which are correlated at once. */
+#define SHAPE_GLYPHS ((GLYPH_ATLAS_COUNT + 3) & ~3)
+static int16_t shape_atlas[SHAPE_GLYPHS][SHAPE_PIXELS];
+static int32_t shape_sum[GLYPH_ATLAS_COUNT];
+static double shape_inv_var[GLYPH_ATLAS_COUNT];
+
+/* The Braille dot bit of each sample of a 2x4 cell, row by row. */
+static const uint8_t braille_dots[8] = {
+    0x01, 0x08, 0x02, 0x10, 0x04, 0x20, 0x40, 0x80
+};
+
+static const uint8_t ordered2_table[] = {
+    0x00, 0x80,
+    0xC0, 0x40
+};
+
+static const uint8_t ordered4_table[] = {
+    0x00, 0x80, 0x20, 0xA0,
+    0xC0, 0x40, 0xE0, 0x60,
+    0x30, 0xB0, 0x10, 0x90,
+    0xF0, 0x70, 0xD0, 0x50
+};
+
+static const uint8_t ordered8_table[] = {
+    0x00, 0x80, 0x20, 0xA0, 0x08, 0x88, 0x28, 0xA8,
+    0xC0, 0x40, 0xE0, 0x60, 0xC8, 0x48, 0xE8, 0x68,
+    0x30, 0xB0, 0x10, 0x90, 0x38, 0xB8, 0x18, 0x98,
+    0xF0, 0x70, 0xD0, 0x50, 0xF8, 0x78, 0xD8, 0x58,
+    0x0C, 0x8C, 0x2C, 0xAC, 0x04, 0x84, 0x24, 0xA4,
+    0xCC, 0x4C, 0xEC, 0x6C, 0xC4, 0x44, 0xE4, 0x64,
+    0x3C, 0xBC, 0x1C, 0x9C, 0x34, 0xB4, 0x14, 0x94,
+    0xFC, 0x7C, 0xDC, 0x5C, 0xF4, 0x74, 0xD4, 0x54
+};
+
+/* The palette laid out for _mm_madd_epi16(): red and green are interleaved
+ * in rg, blue is interleaved with zeroes in b0. Entries with a weight of 2
+ * have all bits set in double_mask, so that the weighting is just an AND and
+ * an add.
+ */
+struct palette_table
+{
+    int16_t rg[32];
+    int16_t b0[32];
+    int32_t double_mask[16];
+};
+
+/* base_palette is searched for the background color, mixed_palette[bg] for
+ * the foreground color: it contains the halfway points between bg and each
+ * palette entry.
+ */
+static struct palette_table base_palette;
+static struct palette_table mixed_palette[16];
+
+/* Every foreground/background pair of the 16 colors, indexed by
+ * 16 * bg + fg, one array per term so that consecutive pairs fill a vector.
+ * d is fg - bg, dd its squared length and coverage_scale GLYPH_STEPS / dd,
+ * or 0 if fg == bg.
+ */
+struct pair_table
+{
+    float bg[3][256];
+    float d[3][256];
+    float dd[256];
+    float coverage_scale[256];
+};
+static struct pair_table pairs;
+
+/* Colors 16-255 of the xterm palette as 12-bit channels, and the closest one
+ * for each 32x32x32 bin of RGB space. Colors 0-15 are left out since
+ * terminals often redefine them.
+ */
+#define XTERM_LUT_BITS 5
+static int xterm_rgb[256][3];
+static uint8_t xterm_lut[1 << (3 * XTERM_LUT_BITS)];
+
+struct kernels
+{
+    /* Expands n pixels of the given format to RGBA */
+    void (*expand_row)(
+        enum pixel_format format, const unsigned char* src,
+        unsigned char* dst, int n
+    );
+    /* acc[i] += src[i] for n bytes */
+    void (*accumulate_row)(uint32_t* acc, const uint8_t* src, int n);
+    /* Sums the RGBA accumulators of pixels [from, to) */
+    void (*sum_span)(const uint32_t* acc, int from, int to, uint32_t sum[4]);
+    /* Index of the closest palette entry, skip is never returned */
+    int (*closest_color)(
+        const struct palette_table* t, int r, int g, int b, int skip
+    );
+    /* Bit i is set when luma[i] > threshold */
+    unsigned (*threshold_mask)(const int32_t luma[8], int32_t threshold);
+    /* Index of the pair whose best glyph mix is closest to v */
+    int (*best_pair)(const float v[3]);
+    /* Dot products of the block with every glyph of shape_atlas */
+    void (*correlate_glyphs)(
+        const int16_t block[SHAPE_PIXELS], int32_t dots[SHAPE_GLYPHS]
+    );
+};
+static struct kernels kernels;
+
+static const int pixel_size[] = { 4, 3, 4, 3, 1, 2 };
+
+/* Expands n pixels to RGBA. */
+static void expand_row_scalar(
+    enum pixel_format format, const unsigned char* src, unsigned char* dst,
+    int n
+){
+    switch(format)
+    {
+    case PIXEL_RGBA:
+        memcpy(dst, src, 4 * (size_t)n);
+        break;
+    case PIXEL_RGB:
+        /* The common case of decoded images without alpha. */
+        for(int i = 0; i < n; ++i, src += 3, dst += 4)
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = 0xFF;
+        }
+        break;
+    case PIXEL_BGR:
+    case PIXEL_BGRA:
+        {
+            int size = pixel_size[format];
+            for(int i = 0; i < n; ++i, src += size, dst += 4)
+            {
+                dst[0] = src[2];
+                dst[1] = src[1];
+                dst[2] = src[0];
+                dst[3] = format == PIXEL_BGRA ? src[3] : 0xFF;
+            }
+        }
+        break;
+    case PIXEL_GRAY:
+        for(int i = 0; i < n; ++i, dst += 4)
+        {
+            dst[0] = dst[1] = dst[2] = src[i];
+            dst[3] = 0xFF;
+        }
+        break;
+    case PIXEL_GRAY_ALPHA:
+        for(int i = 0; i < n; ++i, src += 2, dst += 4)
+        {
+            dst[0] = dst[1] = dst[2] = src[0];
+            dst[3] = src[1];
+        }
+        break;
+    }
+}
+
+static void accumulate_row_scalar(uint32_t* acc, const uint8_t* src, int n)
+{
+    for(int i = 0; i < n; ++i) acc[i] += src[i];
+}
+
+static void sum_span_scalar(
+    const uint32_t* acc, int from, int to, uint32_t sum[4]
+){
+    sum[0] = sum[1] = sum[2] = sum[3] = 0;
+    for(int x = from; x < to; ++x)
+        for(int i = 0; i < 4; ++i) sum[i] += acc[x * 4 + i];
+}
+
+static int closest_color_scalar(
+    const struct palette_table* t, int r, int g, int b, int skip
+){
+    int best = 0;
+    int32_t best_dist = INT32_MAX;
+    for(int i = 0; i < 16; ++i)
+    {
+        if(i == skip) continue;
+        int32_t dr = r - t->rg[2*i];
+        int32_t dg = g - t->rg[2*i+1];
+        int32_t db = b - t->b0[2*i];
+        int32_t dist = dr * dr + dg * dg + db * db;
+        dist += dist & t->double_mask[i];
+        if(dist < best_dist)
+        {
+            best = i;
+            best_dist = dist;
+        }
+    }
+    return best;
+}
+
+static unsigned threshold_mask_scalar(
+    const int32_t luma[8], int32_t threshold
+){
+    unsigned mask = 0;
+    for(int i = 0; i < 8; ++i) mask |= (luma[i] > threshold) << i;
+    return mask;
+}
+
+/* The glyph that best mixes pair i into v, and its squared error. The
+ * coverage of fg that minimizes the error is found by projecting v onto the
+ * line from bg to fg, and then rounded to the closest glyph. Only the
+ * glyphs up to GLYPH_COUNT - 2 are used, the pair swapped around covers the
+ * rest.
+ */
+static inline float pair_error(const float v[3], int i, int* glyph)
+{
+    float u0 = v[0] - pairs.bg[0][i];
+    float u1 = v[1] - pairs.bg[1][i];
+    float u2 = v[2] - pairs.bg[2][i];
+    float ud = u0 * pairs.d[0][i] + u1 * pairs.d[1][i] + u2 * pairs.d[2][i];
+    float uu = u0 * u0 + u1 * u1 + u2 * u2;
+    float k = ud * pairs.coverage_scale[i] + 0.5f;
+    k = k < 0.0f ? 0.0f : k > GLYPH_COUNT - 2 ? GLYPH_COUNT - 2 : k;
+    k = (float)(int)k;
+    float t = k * (1.0f / GLYPH_STEPS);
+    *glyph = (int)k;
+    return uu - t * (2.0f * ud - t * pairs.dd[i]);
+}
+
+static int best_pair_scalar(const float v[3])
+{
+    int best = 0, glyph;
+    float best_error = pair_error(v, 0, &glyph);
+    for(int i = 1; i < 256; ++i)
+    {
+        float error = pair_error(v, i, &glyph);
+        if(error < best_error)
+        {
+            best = i;
+            best_error = error;
+        }
+    }
+    return best;
+}
+
+static void correlate_glyphs_scalar(
+    const int16_t block[SHAPE_PIXELS], int32_t dots[SHAPE_GLYPHS]
+){
+    for(int g = 0; g < SHAPE_GLYPHS; ++g)
+    {
+        int32_t dot = 0;
+        for(int i = 0; i < SHAPE_PIXELS; ++i)
+            dot += block[i] * shape_atlas[g][i];
+        dots[g] = dot;
+    }
+}
+
+#ifdef RENDER_X86
+/* Moves pixel k of four packed 3-byte pixels to 32-bit lane k, with a zero
+ * top byte. SSE2 has no byte shuffle, so each pixel is shifted into place.
+ */
+static inline __m128i spread_rgb_sse2(__m128i v)
+{
+    __m128i m = _mm_setr_epi32(0xFFFFFF, 0, 0, 0);
+    __m128i p = _mm_and_si128(v, m);
+    p = _mm_or_si128(
+        p, _mm_and_si128(_mm_slli_si128(v, 1), _mm_slli_si128(m, 4))
+    );
+    p = _mm_or_si128(
+        p, _mm_and_si128(_mm_slli_si128(v, 2), _mm_slli_si128(m, 8))
+    );
+    return _mm_or_si128(
+        p, _mm_and_si128(_mm_slli_si128(v, 3), _mm_slli_si128(m, 12))
+    );
+}
+
+/* Swaps the first and third byte of every 32-bit lane. */
+static inline __m128i swap_red_blue_sse2(__m128i v)
+{
+    __m128i low = _mm_set1_epi32(0xFF);
+    __m128i r = _mm_and_si128(_mm_srli_epi32(v, 16), low);
+    __m128i b = _mm_slli_epi32(_mm_and_si128(v, low), 16);
+    v = _mm_and_si128(v, _mm_set1_epi32((int)0xFF00FF00));
+    return _mm_or_si128(v, _mm_or_si128(r, b));
+}
+
+static void expand_row_sse2(
+    enum pixel_format format, const unsigned char* src, unsigned char* dst,
+    int n
+){
+    __m128i opaque = _mm_set1_epi32((int)0xFF000000);
+    __m128i* out = (__m128i*)dst;
+    int i = 0;
+    switch(format)
+    {
+    case PIXEL_GRAY:
+        for(; i + 16 <= n; i += 16, out += 4)
+        {
+            __m128i g = _mm_loadu_si128((const __m128i*)(src + i));
+            __m128i ga = _mm_unpacklo_epi8(g, _mm_set1_epi8(-1));
+            __m128i gg = _mm_unpacklo_epi8(g, g);
+            _mm_storeu_si128(out, _mm_unpacklo_epi16(gg, ga));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(gg, ga));
+            ga = _mm_unpackhi_epi8(g, _mm_set1_epi8(-1));
+            gg = _mm_unpackhi_epi8(g, g);
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(gg, ga));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(gg, ga));
+        }
+        break;
+    case PIXEL_GRAY_ALPHA:
+        for(; i + 8 <= n; i += 8, out += 2)
+        {
+            __m128i ga = _mm_loadu_si128((const __m128i*)(src + 2 * i));
+            __m128i gg = _mm_or_si128(
+                _mm_slli_epi16(ga, 8), _mm_and_si128(ga, _mm_set1_epi16(0xFF))
+            );
+            _mm_storeu_si128(out, _mm_unpacklo_epi16(gg, ga));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(gg, ga));
+        }
+        break;
+    /* Each load reads 4 bytes past the 4 pixels it expands. */
+    case PIXEL_RGB:
+        for(; i + 6 <= n; i += 4, out++)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(src + 3 * i));
+            _mm_storeu_si128(out, _mm_or_si128(spread_rgb_sse2(v), opaque));
+        }
+        break;
+    case PIXEL_BGR:
+        for(; i + 6 <= n; i += 4, out++)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(src + 3 * i));
+            v = swap_red_blue_sse2(spread_rgb_sse2(v));
+            _mm_storeu_si128(out, _mm_or_si128(v, opaque));
+        }
+        break;
+    case PIXEL_BGRA:
+        for(; i + 4 <= n; i += 4, out++)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(src + 4 * i));
+            _mm_storeu_si128(out, swap_red_blue_sse2(v));
+        }
+        break;
+    case PIXEL_RGBA:
+        break;
+    }
+    expand_row_scalar(
+        format, src + i * pixel_size[format], dst + 4 * i, n - i
+    );
+}
+
+static void accumulate_row_sse2(uint32_t* acc, const uint8_t* src, int n)
+{
+    __m128i zero = _mm_setzero_si128();
+    int i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+        __m128i* a = (__m128i*)(acc + i);
+        _mm_storeu_si128(a, _mm_add_epi32(
+            _mm_loadu_si128(a), _mm_unpacklo_epi16(lo, zero)
+        ));
+        _mm_storeu_si128(a + 1, _mm_add_epi32(
+            _mm_loadu_si128(a + 1), _mm_unpackhi_epi16(lo, zero)
+        ));
+        _mm_storeu_si128(a + 2, _mm_add_epi32(
+            _mm_loadu_si128(a + 2), _mm_unpacklo_epi16(hi, zero)
+        ));
+        _mm_storeu_si128(a + 3, _mm_add_epi32(
+            _mm_loadu_si128(a + 3), _mm_unpackhi_epi16(hi, zero)
+        ));
+    }
+    accumulate_row_scalar(acc + i, src + i, n - i);
+}
+
+static void sum_span_sse2(
+    const uint32_t* acc, int from, int to, uint32_t sum[4]
+){
+    __m128i s = _mm_setzero_si128();
+    for(int x = from; x < to; ++x)
+        s = _mm_add_epi32(s, _mm_loadu_si128((const __m128i*)(acc + x * 4)));
+    _mm_storeu_si128((__m128i*)sum, s);
+}
+
+static inline __m128i min_epi32_sse2(__m128i a, __m128i b)
+{
+    __m128i lt = _mm_cmplt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(lt, a), _mm_andnot_si128(lt, b));
+}
+
+static int closest_color_sse2(
+    const struct palette_table* t, int r, int g, int b, int skip
+){
+    __m128i rg = _mm_unpacklo_epi16(_mm_set1_epi16(r), _mm_set1_epi16(g));
+    __m128i b0 = _mm_unpacklo_epi16(_mm_set1_epi16(b), _mm_setzero_si128());
+    __m128i skipv = _mm_set1_epi32(skip);
+    __m128i maxv = _mm_set1_epi32(INT32_MAX);
+    __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i min = maxv;
+    __m128i dist[4];
+
+    for(int i = 0; i < 4; ++i)
+    {
+        __m128i drg = _mm_sub_epi16(
+            rg, _mm_loadu_si128((const __m128i*)t->rg + i)
+        );
+        __m128i db = _mm_sub_epi16(
+            b0, _mm_loadu_si128((const __m128i*)t->b0 + i)
+        );
+        __m128i d = _mm_add_epi32(
+            _mm_madd_epi16(drg, drg), _mm_madd_epi16(db, db)
+        );
+        d = _mm_add_epi32(d, _mm_and_si128(
+            d, _mm_loadu_si128((const __m128i*)t->double_mask + i)
+        ));
+        __m128i skipped = _mm_cmpeq_epi32(index, skipv);
+        d = _mm_or_si128(
+            _mm_andnot_si128(skipped, d), _mm_and_si128(skipped, maxv)
+        );
+        min = min_epi32_sse2(min, d);
+        dist[i] = d;
+        index = _mm_add_epi32(index, _mm_set1_epi32(4));
+    }
+    min = min_epi32_sse2(min, _mm_shuffle_epi32(min, _MM_SHUFFLE(1,0,3,2)));
+    min = min_epi32_sse2(min, _mm_shuffle_epi32(min, _MM_SHUFFLE(2,3,0,1)));
+
+    int mask = 0;
+    for(int i = 0; i < 4; ++i)
+        mask |= _mm_movemask_ps(
+            _mm_castsi128_ps(_mm_cmpeq_epi32(dist[i], min))
+        ) << (4 * i);
+    return __builtin_ctz(mask);
+}
+
+static unsigned threshold_mask_sse2(
+    const int32_t luma[8], int32_t threshold
+){
+    __m128i t = _mm_set1_epi32(threshold);
+    __m128i lo = _mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)luma), t);
+    __m128i hi = _mm_cmpgt_epi32(
+        _mm_loadu_si128((const __m128i*)luma + 1), t
+    );
+    return _mm_movemask_ps(_mm_castsi128_ps(lo)) |
+        _mm_movemask_ps(_mm_castsi128_ps(hi)) << 4;
+}
+
+/* pair_error() for pairs [i, i + 4). */
+static inline __m128 pair_error_sse2(const __m128 v[3], int i)
+{
+    __m128 u0 = _mm_sub_ps(v[0], _mm_loadu_ps(pairs.bg[0] + i));
+    __m128 u1 = _mm_sub_ps(v[1], _mm_loadu_ps(pairs.bg[1] + i));
+    __m128 u2 = _mm_sub_ps(v[2], _mm_loadu_ps(pairs.bg[2] + i));
+    __m128 ud = _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(u0, _mm_loadu_ps(pairs.d[0] + i)),
+        _mm_mul_ps(u1, _mm_loadu_ps(pairs.d[1] + i))),
+        _mm_mul_ps(u2, _mm_loadu_ps(pairs.d[2] + i))
+    );
+    __m128 uu = _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(u0, u0), _mm_mul_ps(u1, u1)), _mm_mul_ps(u2, u2)
+    );
+    __m128 k = _mm_add_ps(
+        _mm_mul_ps(ud, _mm_loadu_ps(pairs.coverage_scale + i)),
+        _mm_set1_ps(0.5f)
+    );
+    k = _mm_min_ps(
+        _mm_max_ps(k, _mm_setzero_ps()), _mm_set1_ps(GLYPH_COUNT - 2)
+    );
+    k = _mm_cvtepi32_ps(_mm_cvttps_epi32(k));
+    __m128 t = _mm_mul_ps(k, _mm_set1_ps(1.0f / GLYPH_STEPS));
+    return _mm_sub_ps(uu, _mm_mul_ps(t, _mm_sub_ps(
+        _mm_mul_ps(_mm_set1_ps(2.0f), ud),
+        _mm_mul_ps(t, _mm_loadu_ps(pairs.dd + i))
+    )));
+}
+
+/* Each lane keeps its first minimum, and the lowest index wins among the
+ * lanes with the same error, so ties go to the same pair as in the scalar
+ * search.
+ */
+static int best_pair_sse2(const float v[3])
+{
+    __m128 vv[3] = {
+        _mm_set1_ps(v[0]), _mm_set1_ps(v[1]), _mm_set1_ps(v[2])
+    };
+    __m128 best_error = _mm_set1_ps(INFINITY);
+    __m128i best = _mm_setzero_si128();
+    __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+
+    for(int i = 0; i < 256; i += 4)
+    {
+        __m128 error = pair_error_sse2(vv, i);
+        __m128 lt = _mm_cmplt_ps(error, best_error);
+        best_error = _mm_min_ps(error, best_error);
+        best = _mm_or_si128(
+            _mm_and_si128(_mm_castps_si128(lt), index),
+            _mm_andnot_si128(_mm_castps_si128(lt), best)
+        );
+        index = _mm_add_epi32(index, _mm_set1_epi32(4));
+    }
+
+    float errors[4];
+    int32_t indices[4];
+    _mm_storeu_ps(errors, best_error);
+    _mm_storeu_si128((__m128i*)indices, best);
+    int lane = 0;
+    for(int i = 1; i < 4; ++i)
+        if(errors[i] < errors[lane] ||
+            (errors[i] == errors[lane] && indices[i] < indices[lane]))
+            lane = i;
+    return indices[lane];
+}
+
+/* Sums of the lanes of a, b, c and d, in that order. */
+static inline __m128i hsum4_epi32_sse2(
+    __m128i a, __m128i b, __m128i c, __m128i d
+){
+    __m128i ab = _mm_add_epi32(
+        _mm_unpacklo_epi32(a, b), _mm_unpackhi_epi32(a, b)
+    );
+    __m128i cd = _mm_add_epi32(
+        _mm_unpacklo_epi32(c, d), _mm_unpackhi_epi32(c, d)
+    );
+    return _mm_add_epi32(
+        _mm_unpacklo_epi64(ab, cd), _mm_unpackhi_epi64(ab, cd)
+    );
+}
+
+/* The block stays in registers while the atlas streams past it, four
+ * glyphs at a time to share the horizontal sums.
+ */
+static void correlate_glyphs_sse2(
+    const int16_t block[SHAPE_PIXELS], int32_t dots[SHAPE_GLYPHS]
+){
+    __m128i b[SHAPE_PIXELS / 8];
+    for(int i = 0; i < SHAPE_PIXELS / 8; ++i)
+        b[i] = _mm_loadu_si128((const __m128i*)block + i);
+
+    for(int g = 0; g < SHAPE_GLYPHS; g += 4)
+    {
+        __m128i dot[4];
+        for(int k = 0; k < 4; ++k)
+        {
+            const __m128i* a = (const __m128i*)shape_atlas[g + k];
+            dot[k] = _mm_madd_epi16(b[0], _mm_loadu_si128(a));
+            for(int i = 1; i < SHAPE_PIXELS / 8; ++i)
+                dot[k] = _mm_add_epi32(
+                    dot[k], _mm_madd_epi16(b[i], _mm_loadu_si128(a + i))
+                );
+        }
+        _mm_storeu_si128(
+            (__m128i*)(dots + g),
+            hsum4_epi32_sse2(dot[0], dot[1], dot[2], dot[3])
+        );
+    }
+}
+
+__attribute__((target("avx2")))
+static void accumulate_row_avx2(uint32_t* acc, const uint8_t* src, int n)
+{
+    int i = 0;
+    for(; i + 32 <= n; i += 32)
+    {
+        for(int j = 0; j < 32; j += 8)
+        {
+            __m256i* a = (__m256i*)(acc + i + j);
+            __m256i v = _mm256_cvtepu8_epi32(
+                _mm_loadl_epi64((const __m128i*)(src + i + j))
+            );
+            _mm256_storeu_si256(a, _mm256_add_epi32(_mm256_loadu_si256(a), v));
+        }
+    }
+    accumulate_row_sse2(acc + i, src + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static void sum_span_avx2(
+    const uint32_t* acc, int from, int to, uint32_t sum[4]
+){
+    __m256i s = _mm256_setzero_si256();
+    int x = from;
+    for(; x + 2 <= to; x += 2)
+        s = _mm256_add_epi32(
+            s, _mm256_loadu_si256((const __m256i*)(acc + x * 4))
+        );
+    __m128i s4 = _mm_add_epi32(
+        _mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1)
+    );
+    if(x < to)
+        s4 = _mm_add_epi32(s4, _mm_loadu_si128((const __m128i*)(acc + x * 4)));
+    _mm_storeu_si128((__m128i*)sum, s4);
+}
+
+__attribute__((target("avx2")))
+static int closest_color_avx2(
+    const struct palette_table* t, int r, int g, int b, int skip
+){
+    __m256i rg = _mm256_unpacklo_epi16(
+        _mm256_set1_epi16(r), _mm256_set1_epi16(g)
+    );
+    __m256i b0 = _mm256_unpacklo_epi16(
+        _mm256_set1_epi16(b), _mm256_setzero_si256()
+    );
+    __m256i skipv = _mm256_set1_epi32(skip);
+    __m256i maxv = _mm256_set1_epi32(INT32_MAX);
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i dist[2];
+
+    for(int i = 0; i < 2; ++i)
+    {
+        __m256i drg = _mm256_sub_epi16(
+            rg, _mm256_loadu_si256((const __m256i*)t->rg + i)
+        );
+        __m256i db = _mm256_sub_epi16(
+            b0, _mm256_loadu_si256((const __m256i*)t->b0 + i)
+        );
+        __m256i d = _mm256_add_epi32(
+            _mm256_madd_epi16(drg, drg), _mm256_madd_epi16(db, db)
+        );
+        d = _mm256_add_epi32(d, _mm256_and_si256(
+            d, _mm256_loadu_si256((const __m256i*)t->double_mask + i)
+        ));
+        d = _mm256_blendv_epi8(d, maxv, _mm256_cmpeq_epi32(index, skipv));
+        dist[i] = d;
+        index = _mm256_add_epi32(index, _mm256_set1_epi32(8));
+    }
+    __m256i min = _mm256_min_epi32(dist[0], dist[1]);
+    min = _mm256_min_epi32(min, _mm256_permute2x128_si256(min, min, 1));
+    min = _mm256_min_epi32(
+        min, _mm256_shuffle_epi32(min, _MM_SHUFFLE(1,0,3,2))
+    );
+    min = _mm256_min_epi32(
+        min, _mm256_shuffle_epi32(min, _MM_SHUFFLE(2,3,0,1))
+    );
+
+    int mask =
+        _mm256_movemask_ps(_mm256_castsi256_ps(
+            _mm256_cmpeq_epi32(dist[0], min)
+        )) |
+        _mm256_movemask_ps(_mm256_castsi256_ps(
+            _mm256_cmpeq_epi32(dist[1], min)
+        )) << 8;
+    return __builtin_ctz(mask);
+}
+
+__attribute__((target("avx2")))
+static inline __m256 pair_error_avx2(const __m256 v[3], int i)
+{
+    __m256 u0 = _mm256_sub_ps(v[0], _mm256_loadu_ps(pairs.bg[0] + i));
+    __m256 u1 = _mm256_sub_ps(v[1], _mm256_loadu_ps(pairs.bg[1] + i));
+    __m256 u2 = _mm256_sub_ps(v[2], _mm256_loadu_ps(pairs.bg[2] + i));
+    __m256 ud = _mm256_add_ps(_mm256_add_ps(
+        _mm256_mul_ps(u0, _mm256_loadu_ps(pairs.d[0] + i)),
+        _mm256_mul_ps(u1, _mm256_loadu_ps(pairs.d[1] + i))),
+        _mm256_mul_ps(u2, _mm256_loadu_ps(pairs.d[2] + i))
+    );
+    __m256 uu = _mm256_add_ps(_mm256_add_ps(
+        _mm256_mul_ps(u0, u0), _mm256_mul_ps(u1, u1)), _mm256_mul_ps(u2, u2)
+    );
+    __m256 k = _mm256_add_ps(
+        _mm256_mul_ps(ud, _mm256_loadu_ps(pairs.coverage_scale + i)),
+        _mm256_set1_ps(0.5f)
+    );
+    k = _mm256_min_ps(
+        _mm256_max_ps(k, _mm256_setzero_ps()), _mm256_set1_ps(GLYPH_COUNT - 2)
+    );
+    k = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(k));
+    __m256 t = _mm256_mul_ps(k, _mm256_set1_ps(1.0f / GLYPH_STEPS));
+    return _mm256_sub_ps(uu, _mm256_mul_ps(t, _mm256_sub_ps(
+        _mm256_mul_ps(_mm256_set1_ps(2.0f), ud),
+        _mm256_mul_ps(t, _mm256_loadu_ps(pairs.dd + i))
+    )));
+}
+
+__attribute__((target("avx2")))
+static int best_pair_avx2(const float v[3])
+{
+    __m256 vv[3] = {
+        _mm256_set1_ps(v[0]), _mm256_set1_ps(v[1]), _mm256_set1_ps(v[2])
+    };
+    __m256 best_error = _mm256_set1_ps(INFINITY);
+    __m256i best = _mm256_setzero_si256();
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    for(int i = 0; i < 256; i += 8)
+    {
+        __m256 error = pair_error_avx2(vv, i);
+        __m256 lt = _mm256_cmp_ps(error, best_error, _CMP_LT_OQ);
+        best_error = _mm256_min_ps(error, best_error);
+        best = _mm256_blendv_epi8(best, index, _mm256_castps_si256(lt));
+        index = _mm256_add_epi32(index, _mm256_set1_epi32(8));
+    }
+
+    float errors[8];
+    int32_t indices[8];
+    _mm256_storeu_ps(errors, best_error);
+    _mm256_storeu_si256((__m256i*)indices, best);
+    int lane = 0;
+    for(int i = 1; i < 8; ++i)
+        if(errors[i] < errors[lane] ||
+            (errors[i] == errors[lane] && indices[i] < indices[lane]))
+            lane = i;
+    return indices[lane];
+}
+
+__attribute__((target("avx2")))
+static void correlate_glyphs_avx2(
+    const int16_t block[SHAPE_PIXELS], int32_t dots[SHAPE_GLYPHS]
+){
+    __m256i b[SHAPE_PIXELS / 16];
+    for(int i = 0; i < SHAPE_PIXELS / 16; ++i)
+        b[i] = _mm256_loadu_si256((const __m256i*)block + i);
+
+    for(int g = 0; g < SHAPE_GLYPHS; g += 4)
+    {
+        __m128i dot[4];
+        for(int k = 0; k < 4; ++k)
+        {
+            const __m256i* a = (const __m256i*)shape_atlas[g + k];
+            __m256i d = _mm256_madd_epi16(b[0], _mm256_loadu_si256(a));
+            for(int i = 1; i < SHAPE_PIXELS / 16; ++i)
+                d = _mm256_add_epi32(
+                    d, _mm256_madd_epi16(b[i], _mm256_loadu_si256(a + i))
+                );
+            dot[k] = _mm_add_epi32(
+                _mm256_castsi256_si128(d), _mm256_extracti128_si256(d, 1)
+            );
+        }
+        _mm_storeu_si128(
+            (__m128i*)(dots + g),
+            hsum4_epi32_sse2(dot[0], dot[1], dot[2], dot[3])
+        );
+    }
+}
+
+__attribute__((target("avx2")))
+static unsigned threshold_mask_avx2(
+    const int32_t luma[8], int32_t threshold
+){
+    __m256i gt = _mm256_cmpgt_epi32(
+        _mm256_loadu_si256((const __m256i*)luma), _mm256_set1_epi32(threshold)
+    );
+    return _mm256_movemask_ps(_mm256_castsi256_ps(gt));
+}
+#endif
+
+static void fill_palette_table(
+    struct palette_table* t, const int (*rgb)[3]
+){
+    for(int i = 0; i < 16; ++i)
+    {
+        t->rg[2*i] = rgb[i][0];
+        t->rg[2*i+1] = rgb[i][1];
+        t->b0[2*i] = rgb[i][2];
+        t->b0[2*i+1] = 0;
+        t->double_mask[i] = palette_weight[i] == 2 ? -1 : 0;
+    }
+}
+
+static const int xterm_cube_levels[6] = { 0, 95, 135, 175, 215, 255 };
+
+static int closest_cube_level(int c)
+{
+    int best = 0;
+    for(int i = 1; i < 6; ++i)
+        if(abs(c - xterm_cube_levels[i]) < abs(c - xterm_cube_levels[best]))
+            best = i;
+    return best;
+}
+
+/* The cube is a grid, so its closest color can be found per channel, and the
+ * closest gray is the one closest to the mean. Only the two need comparing.
+ */
+static void init_xterm_palette(void)
+{
+    int rgb8[256][3];
+
+    for(int i = 16; i < 232; ++i)
+    {
+        rgb8[i][0] = xterm_cube_levels[(i - 16) / 36];
+        rgb8[i][1] = xterm_cube_levels[(i - 16) / 6 % 6];
+        rgb8[i][2] = xterm_cube_levels[(i - 16) % 6];
+    }
+    for(int i = 232; i < 256; ++i)
+        rgb8[i][0] = rgb8[i][1] = rgb8[i][2] = 8 + 10 * (i - 232);
+    for(int i = 16; i < 256; ++i)
+        for(int c = 0; c < 3; ++c)
+            xterm_rgb[i][c] = (rgb8[i][c] << 4) | (rgb8[i][c] >> 4);
+
+    int bins = 1 << XTERM_LUT_BITS;
+    int bin_size = 256 / bins;
+    for(int i = 0; i < bins * bins * bins; ++i)
+    {
+        int rgb[3] = {
+            (i >> (2 * XTERM_LUT_BITS)) * bin_size + bin_size / 2,
+            (i >> XTERM_LUT_BITS) % bins * bin_size + bin_size / 2,
+            i % bins * bin_size + bin_size / 2
+        };
+        int cube = 16 + 36 * closest_cube_level(rgb[0]) +
+            6 * closest_cube_level(rgb[1]) + closest_cube_level(rgb[2]);
+        int gray = ((rgb[0] + rgb[1] + rgb[2]) / 3 - 3) / 10;
+        gray = 232 + (gray < 0 ? 0 : gray > 23 ? 23 : gray);
+
+        int cube_dist = 0, gray_dist = 0;
+        for(int c = 0; c < 3; ++c)
+        {
+            cube_dist += (rgb[c] - rgb8[cube][c]) * (rgb[c] - rgb8[cube][c]);
+            gray_dist += (rgb[c] - rgb8[gray][c]) * (rgb[c] - rgb8[gray][c]);
+        }
+        xterm_lut[i] = gray_dist < cube_dist ? gray : cube;
+    }
+}
+
+/* Sextants cover every 2x3 pattern except the ones already in the block
+ * elements: empty, full and the left and right halves.
+ */
+static void init_pattern_glyphs(void)
+{
+    for(int mask = 0; mask < 256; ++mask)
+    {
+        int dots = 0;
+        for(int i = 0; i < 8; ++i)
+            if(mask & (1 << i)) dots |= braille_dots[i];
+        braille_glyphs[mask] = 0x2800 + dots;
+    }
+    braille_glyphs[0] = ' ';
+
+    for(int mask = 1; mask < 63; ++mask)
+        sextant_glyphs[mask] = 0x1FB00 + mask - 1 - (mask > 21) - (mask > 42);
+    sextant_glyphs[0] = ' ';
+    sextant_glyphs[21] = 0x258C;
+    sextant_glyphs[42] = 0x2590;
+    sextant_glyphs[63] = 0x2588;
+}
+
+static void init_pair_table(void)
+{
+    for(int bg = 0; bg < 16; ++bg)
+    for(int fg = 0; fg < 16; ++fg)
+    {
+        int i = 16 * bg + fg;
+        float dd = 0;
+        for(int c = 0; c < 3; ++c)
+        {
+            pairs.bg[c][i] = palette_rgb[bg][c];
+            pairs.d[c][i] = palette_rgb[fg][c] - palette_rgb[bg][c];
+            dd += pairs.d[c][i] * pairs.d[c][i];
+        }
+        pairs.dd[i] = dd;
+        pairs.coverage_scale[i] = fg == bg ? 0 : GLYPH_STEPS / dd;
+    }
+}
+
+static void init_shape_atlas(void)
+{
+    for(int g = 0; g < GLYPH_ATLAS_COUNT; ++g)
+    {
+        int64_t sq = 0;
+        shape_sum[g] = 0;
+        for(int i = 0; i < SHAPE_PIXELS; ++i)
+        {
+            int a = glyph_atlas[g][i];
+            shape_atlas[g][i] = a;
+            shape_sum[g] += a;
+            sq += a * a;
+        }
+        int64_t var = SHAPE_PIXELS * sq - (int64_t)shape_sum[g] * shape_sum[g];
+        shape_inv_var[g] = var ? 1.0 / var : 0;
+    }
+}
+
+static void init_kernels(void)
+{
+    static int initialized = 0;
+    if(initialized) return;
+    initialized = 1;
+
+    kernels.expand_row = expand_row_scalar;
+    kernels.accumulate_row = accumulate_row_scalar;
+    kernels.sum_span = sum_span_scalar;
+    kernels.closest_color = closest_color_scalar;
+    kernels.threshold_mask = threshold_mask_scalar;
+    kernels.best_pair = best_pair_scalar;
+    kernels.correlate_glyphs = correlate_glyphs_scalar;
+#ifdef RENDER_X86
+    kernels.expand_row = expand_row_sse2;
+    kernels.accumulate_row = accumulate_row_sse2;
+    kernels.sum_span = sum_span_sse2;
+    kernels.closest_color = closest_color_sse2;
+    kernels.threshold_mask = threshold_mask_sse2;
+    kernels.best_pair = best_pair_sse2;
+    kernels.correlate_glyphs = correlate_glyphs_sse2;
+    if(__builtin_cpu_supports("avx2"))
+    {
+        kernels.accumulate_row = accumulate_row_avx2;
+        kernels.sum_span = sum_span_avx2;
+        kernels.closest_color = closest_color_avx2;
+        kernels.threshold_mask = threshold_mask_avx2;
+        kernels.best_pair = best_pair_avx2;
+        kernels.correlate_glyphs = correlate_glyphs_avx2;
+    }
+#endif
+
+    init_pattern_glyphs();
+    init_pair_table();
+    init_shape_atlas();
+    init_xterm_palette();
+    fill_palette_table(&base_palette, palette_rgb);
+    for(int bg = 0; bg < 16; ++bg)
+    {
+        int mixed[16][3];
+        for(int i = 0; i < 16; ++i)
+            for(int c = 0; c < 3; ++c)
+                mixed[i][c] = (palette_rgb[bg][c] + palette_rgb[i][c]) / 2;
+        fill_palette_table(&mixed_palette[bg], (const int (*)[3])mixed);
+    }
+}
+
+struct sample
+{
+    int r, g, b, a;
+};
+
+struct renderer
+{
+    /* When streaming, the canvas only holds a band of cell rows starting at
+     * cell_y0, and the image data starts at source row img_y0. img->height
+     * is still the height of the whole image.
+     */
+    struct canvas* cv;
+    const struct image* img;
+    int cell_y0, img_y0;
+    const struct render_options* opt;
+    /* Truecolor is never dithered, nor are whole-cell symbol sets diffused,
+     * so this may differ from opt->dither.
+     */
+    enum dither_algorithm dither;
+    /* Truecolor always shows the average of the pixels under each sample,
+     * so this may differ from opt->antialias.
+     */
+    int antialias;
+    uint32_t (*quantize)(int v[3], int error[3]);
+    /* Picks the glyph and colors of a cell in 16 colors. */
+    void (*quantize_cell)(int v[3], struct cell* out, int error[3]);
+    /* Fills a cell row from all of its samples at once, for the symbol sets
+     * that pick glyphs by shape. NULL if cells are filled sample by sample.
+     */
+    void (*block_row)(
+        const struct renderer* r, int y, const struct sample* samples
+    );
+    /* Glyphs by sample mask for the sub-cell symbol sets. */
+    const uint32_t* patterns;
+    /* Each cell covers sub_w * sub_h samples of a grid_w * grid_h grid. */
+    int sub_w, sub_h;
+    int grid_w, grid_h;
+    /* cell_span() of each column of the grid, as from, to pairs. */
+    int* columns;
+    int invert;
+    int gammatab[CHANNEL_MAX + 1];
+    /* At most this many threads, and never more than there are cell rows. */
+    int threads;
+    /* Floyd-Steinberg error rows, err_slots of err_len each. Row y diffuses
+     * into slot (y + 1) % err_slots, so the error carries over from one call
+     * to render_range() to the next.
+     */
+    int* errors;
+    int err_slots;
+    size_t err_len;
+};
+
+/* Pixels [from, to) of the source that map to the given cell or sample. */
+static void cell_span(int cell, int cells, int pixels, int* from, int* to)
+{
+    *from = (int)((int64_t)cell * pixels / cells);
+    *to = (int)((int64_t)(cell + 1) * pixels / cells);
+    /* We want at least one pixel */
+    if(*to == *from) (*to)++;
+}
+
+/* Applies gamma to 12-bit RGBA. The channels are passed by value, since
+ * going through an array here costs a failed store forward per sample.
+ */
+static inline void store_sample(
+    struct sample* s, const int* gammatab, int invert,
+    uint32_t r, uint32_t g, uint32_t b, uint32_t a
+){
+    s->r = invert ? CHANNEL_MAX - gammatab[r] : gammatab[r];
+    s->g = invert ? CHANNEL_MAX - gammatab[g] : gammatab[g];
+    s->b = invert ? CHANNEL_MAX - gammatab[b] : gammatab[b];
+    s->a = a;
+}
+
+/* Row y of the image, whose data starts at row y0. */
+static const unsigned char* image_row(const struct image* img, int y, int y0)
+{
+    ptrdiff_t stride = img->stride;
+    if(!stride) stride = (ptrdiff_t)img->width * pixel_size[img->format];
+    return img->data + (y - y0) * stride;
+}
+
+/* Bytes of scratch memory sample_row() needs with antialiasing: the RGBA
+ * sums of one source row, followed by the row expanded to RGBA unless it
+ * already is.
+ */
+static size_t sample_scratch_size(const struct image* img)
+{
+    size_t size = sizeof(uint32_t) * 4 * img->width;
+    if(img->format != PIXEL_RGBA) size += 4 * (size_t)img->width;
+    return size;
+}
+
+/* Samples row y of the sample grid. acc must have sample_scratch_size()
+ * bytes of room.
+ */
+static void sample_row(
+    const struct renderer* r, int y, struct sample* out, uint32_t* acc
+){
+    const struct image* img = r->img;
+    int rgba = img->format == PIXEL_RGBA;
+    int size = pixel_size[img->format];
+    /* Copied out of r, which the stores to out could otherwise alias. */
+    const int* columns = r->columns;
+    const int* gammatab = r->gammatab;
+    int antialias = r->antialias;
+    int invert = r->invert;
+    int w = r->grid_w;
+    int fromy, toy;
+    cell_span(y, r->grid_h, img->height, &fromy, &toy);
+
+    const unsigned char* center =
+        image_row(img, (fromy + toy) / 2, r->img_y0);
+    if(antialias)
+    {
+        unsigned char* expanded = (unsigned char*)(acc + 4 * img->width);
+        memset(acc, 0, sizeof(uint32_t) * 4 * img->width);
+        for(int sy = fromy; sy < toy; ++sy)
+        {
+            const unsigned char* row = image_row(img, sy, r->img_y0);
+            if(!rgba)
+            {
+                kernels.expand_row(img->format, row, expanded, img->width);
+                row = expanded;
+            }
+            kernels.accumulate_row(acc, row, img->width * 4);
+        }
+    }
+
+    for(int x = 0; x < w; ++x)
+    {
+        int fromx = columns[2 * x], tox = columns[2 * x + 1];
+
+        if(antialias)
+        {
+            uint32_t rgba[4];
+            uint64_t dots = (uint64_t)(tox - fromx) * (toy - fromy);
+            kernels.sum_span(acc, fromx, tox, rgba);
+            /* 32-bit division is much faster, and enough for most spans. */
+            if(dots < (1u << 20))
+                for(int i = 0; i < 4; ++i)
+                    rgba[i] = (rgba[i] << 4) / (uint32_t)dots;
+            else for(int i = 0; i < 4; ++i)
+                rgba[i] = ((uint64_t)rgba[i] << 4) / dots;
+            store_sample(
+                out + x, gammatab, invert, rgba[0], rgba[1], rgba[2], rgba[3]
+            );
+        }
+        else
+        {
+            const unsigned char* p = center + size * ((fromx + tox) / 2);
+            unsigned char expanded[4];
+            if(!rgba)
+            {
+                expand_row_scalar(img->format, p, expanded, 1);
+                p = expanded;
+            }
+            store_sample(
+                out + x, gammatab, invert,
+                p[0] << 4, p[1] << 4, p[2] << 4, p[3] << 4
+            );
+        }
+    }
+}
+
+/* Stateless, so that any cell can be dithered independently of the others. */
+static int random_dither(int x, int y, int channel)
+{
+    uint32_t h = (uint32_t)x * 0x9E3779B1u;
+    h ^= (uint32_t)y * 0x85EBCA77u;
+    h ^= (uint32_t)channel * 0xC2B2AE3Du;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    h *= 0x846CA68Bu;
+    h ^= h >> 16;
+    return h & 0xFF;
+}
+
+/* Returns the threshold offset added to the given channel of a cell. */
+static int dither_offset(enum dither_algorithm d, int x, int y, int channel)
+{
+    int value = 0x80;
+    switch(d)
+    {
+    case DITHER_ORDERED2: value = ordered2_table[(y % 2) * 2 + x % 2]; break;
+    case DITHER_ORDERED4: value = ordered4_table[(y % 4) * 4 + x % 4]; break;
+    case DITHER_ORDERED8: value = ordered8_table[(y % 8) * 8 + x % 8]; break;
+    case DITHER_RANDOM: value = random_dither(x, y, channel); break;
+    case DITHER_BLUENOISE:
+        value = bluenoise_table[
+            (y % BLUENOISE_SIZE) * BLUENOISE_SIZE + x % BLUENOISE_SIZE
+        ];
+        break;
+    default: break;
+    }
+    return (value - 0x80) * 4;
+}
+
+static int clamp_sample(int v)
+{
+    return v < SAMPLE_MIN ? SAMPLE_MIN : v > SAMPLE_MAX ? SAMPLE_MAX : v;
+}
+
+/* Picks the background color closest to the sample, then the foreground
+ * color that best mixes with it, then the glyph whose coverage blends the
+ * two closest to the sample. The remaining error is written to error.
+ */
+static void quantize_cell(int v[3], struct cell* out, int error[3])
+{
+    for(int i = 0; i < 3; ++i) v[i] = clamp_sample(v[i]);
+
+    int bg = kernels.closest_color(&base_palette, v[0], v[1], v[2], -1);
+    int fg = kernels.closest_color(&mixed_palette[bg], v[0], v[1], v[2], bg);
+    const int* bg_rgb = palette_rgb[bg];
+    const int* fg_rgb = palette_rgb[fg];
+
+    int ch = 0;
+    int distmin = INT32_MAX;
+    for(int i = 0; i < GLYPH_COUNT - 1; ++i)
+    {
+        int dist = 0;
+        for(int c = 0; c < 3; ++c)
+            dist += abs(
+                v[c] * GLYPH_STEPS -
+                (i * fg_rgb[c] + (GLYPH_STEPS - i) * bg_rgb[c])
+            );
+        if(dist < distmin)
+        {
+            ch = i;
+            distmin = dist;
+        }
+    }
+
+    for(int c = 0; c < 3; ++c)
+        error[c] = v[c] -
+            (ch * fg_rgb[c] + (GLYPH_STEPS - ch) * bg_rgb[c]) / GLYPH_STEPS;
+
+    out->ch = glyphs[ch];
+    out->fg = fg;
+    out->bg = bg;
+}
+
+/* Like quantize_cell(), but tries every foreground/background pair. */
+static void quantize_cell_exhaustive(int v[3], struct cell* out, int error[3])
+{
+    float vf[3];
+    for(int c = 0; c < 3; ++c)
+    {
+        v[c] = clamp_sample(v[c]);
+        vf[c] = v[c];
+    }
+
+    int glyph;
+    int best = kernels.best_pair(vf);
+    pair_error(vf, best, &glyph);
+    const int* bg_rgb = palette_rgb[best / 16];
+    const int* fg_rgb = palette_rgb[best % 16];
+
+    for(int c = 0; c < 3; ++c)
+        error[c] = v[c] - (
+            glyph * fg_rgb[c] + (GLYPH_STEPS - glyph) * bg_rgb[c]
+        ) / GLYPH_STEPS;
+
+    out->ch = glyphs[glyph];
+    out->fg = best % 16;
+    out->bg = best / 16;
+}
+
+static uint32_t quantize_color_16(int v[3], int error[3])
+{
+    for(int c = 0; c < 3; ++c) v[c] = clamp_sample(v[c]);
+    int color = kernels.closest_color(&base_palette, v[0], v[1], v[2], -1);
+    for(int c = 0; c < 3; ++c) error[c] = v[c] - palette_rgb[color][c];
+    return color;
+}
+
+static uint32_t quantize_color_256(int v[3], int error[3])
+{
+    int bin = 0;
+    for(int c = 0; c < 3; ++c)
+    {
+        v[c] = clamp_sample(v[c]);
+        int channel = v[c] < 0 ? 0 : v[c] > CHANNEL_MAX ? CHANNEL_MAX : v[c];
+        bin = (bin << XTERM_LUT_BITS) | (channel >> (12 - XTERM_LUT_BITS));
+    }
+
+    int color = xterm_lut[bin];
+    for(int c = 0; c < 3; ++c) error[c] = v[c] - xterm_rgb[color][c];
+    return color;
+}
+
+/* Truecolor is never dithered, so there is no error to speak of. */
+static uint32_t quantize_color_24bit(int v[3], int error[3])
+{
+    uint32_t rgb = 0;
+    for(int c = 0; c < 3; ++c)
+    {
+        int channel = v[c] < 0 ? 0 : v[c] > CHANNEL_MAX ? CHANNEL_MAX : v[c];
+        rgb = (rgb << 8) | (channel >> 4);
+        error[c] = 0;
+    }
+    return rgb;
+}
+
+static void clear_cell(struct cell* c)
+{
+    c->ch = ' ';
+    c->fg = COLOR_TRANSPARENT;
+    c->bg = COLOR_TRANSPARENT;
+}
+
+/* Fills a cell with a single color, from the ASCII ramp in 16 colors. */
+static void fill_cell(
+    const struct renderer* r, struct cell* c, int v[3], int error[3]
+){
+    if(r->cv->colors == COLOR_MODE_16) r->quantize_cell(v, c, error);
+    else
+    {
+        c->ch = ' ';
+        c->fg = COLOR_TRANSPARENT;
+        c->bg = r->quantize(v, error);
+    }
+}
+
+/* Quantizes the dithered sample at (x, y) of the sample grid into the cell
+ * covering it and returns the remaining error. A NULL v marks the sample as
+ * transparent.
+ */
+static void put_sample(
+    const struct renderer* r, int x, int y, int v[3], int error[3]
+){
+    struct cell* c = r->cv->cells +
+        (size_t)(y / r->sub_h - r->cell_y0) * r->cv->width + x / r->sub_w;
+
+    if(r->opt->symbols == SYMBOLS_HALF)
+    {
+        uint32_t color = v ? r->quantize(v, error) : COLOR_TRANSPARENT;
+        if(y % 2 == 0) c->fg = color;
+        else c->bg = color;
+    }
+    else if(!v) clear_cell(c);
+    else fill_cell(r, c, v, error);
+}
+
+/* Picks the glyphs of a cell row once all of its samples are in. The upper
+ * half block is drawn in the foreground color, so a transparent top needs
+ * the lower half block instead.
+ */
+static void finish_row(const struct renderer* r, int y)
+{
+    struct cell* row =
+        r->cv->cells + (size_t)(y - r->cell_y0) * r->cv->width;
+    if(r->opt->symbols != SYMBOLS_HALF) return;
+
+    for(int x = 0; x < r->cv->width; ++x)
+    {
+        struct cell* c = row + x;
+        if(c->fg != COLOR_TRANSPARENT) c->ch = 0x2580;
+        else if(c->bg == COLOR_TRANSPARENT) c->ch = ' ';
+        else
+        {
+            c->ch = 0x2584;
+            c->fg = c->bg;
+            c->bg = COLOR_TRANSPARENT;
+        }
+    }
+}
+
+/* Averages the given samples into a color, transparent if there are none. */
+static uint32_t average_color(
+    const struct renderer* r, const int sum[3], int count
+){
+    int v[3], error[3];
+    if(count == 0) return COLOR_TRANSPARENT;
+    for(int c = 0; c < 3; ++c) v[c] = sum[c] / count;
+    return r->quantize(v, error);
+}
+
+/* Fills cell row y of a sub-cell symbol set from its sub_h rows of samples.
+ * Samples brighter than the mean of their cell are set, and the set and
+ * unset ones are colored by their averages. The dither offsets are scaled by
+ * the contrast of the cell, so that they only move samples close to the
+ * mean. If a cell is partly transparent, its opaque samples are all set.
+ */
+static void pattern_row(
+    const struct renderer* r, int y, const struct sample* samples
+){
+    struct cell* row =
+        r->cv->cells + (size_t)(y - r->cell_y0) * r->cv->width;
+    int n = r->sub_w * r->sub_h;
+
+    for(int x = 0; x < r->cv->width; ++x)
+    {
+        const struct sample* s[8];
+        int32_t luma[8];
+        int32_t lo = INT32_MAX, hi = INT32_MIN, sum = 0;
+        int opaque = 0;
+
+        for(int i = 0; i < 8; ++i)
+        {
+            luma[i] = INT32_MIN;
+            if(i >= n) continue;
+            s[i] = samples + (i / r->sub_w) * r->grid_w +
+                x * r->sub_w + i % r->sub_w;
+            if(s[i]->a < ALPHA_THRESHOLD) continue;
+
+            luma[i] = (77 * s[i]->r + 150 * s[i]->g + 29 * s[i]->b) >> 8;
+            if(luma[i] < lo) lo = luma[i];
+            if(luma[i] > hi) hi = luma[i];
+            sum += luma[i];
+            opaque++;
+        }
+
+        int32_t threshold = INT32_MIN;
+        if(opaque == 0)
+        {
+            clear_cell(row + x);
+            continue;
+        }
+        if(opaque == n)
+        {
+            threshold = sum / n;
+            if(r->dither != DITHER_NONE)
+                for(int i = 0; i < n; ++i)
+                    luma[i] += dither_offset(
+                        r->dither,
+                        x * r->sub_w + i % r->sub_w,
+                        y * r->sub_h + i / r->sub_w,
+                        0
+                    ) * (hi - lo) / 1024;
+        }
+        unsigned mask = kernels.threshold_mask(luma, threshold);
+
+        int fg_sum[3] = { 0, 0, 0 }, bg_sum[3] = { 0, 0, 0 };
+        int fg_count = 0;
+        for(int i = 0; i < n; ++i)
+        {
+            if(s[i]->a < ALPHA_THRESHOLD) continue;
+            int* acc = mask & (1 << i) ? fg_sum : bg_sum;
+            acc[0] += s[i]->r;
+            acc[1] += s[i]->g;
+            acc[2] += s[i]->b;
+            fg_count += (mask >> i) & 1;
+        }
+        row[x].ch = r->patterns[mask];
+        row[x].fg = average_color(r, fg_sum, fg_count);
+        row[x].bg = average_color(r, bg_sum, opaque - fg_count);
+    }
+}
+
+/* A glyph is only used if it explains at least this much of the luminance
+ * variance of the cell. Others, such as smooth gradients, are filled with a
+ * single color instead.
+ */
+#define SHAPE_MIN_FIT 0.5
+
+/* Dithers a color sum at cell (x, y) and quantizes it, transparent if the
+ * weight is zero.
+ */
+static uint32_t weighted_color(
+    const struct renderer* r, int x, int y, const int sum[3], int weight
+){
+    int v[3], error[3];
+    if(weight == 0) return COLOR_TRANSPARENT;
+    for(int c = 0; c < 3; ++c)
+        v[c] = sum[c] / weight + dither_offset(r->dither, x, y, c);
+    return r->quantize(v, error);
+}
+
+/* Fills cell row y from its GLYPH_ATLAS_HEIGHT rows of samples by picking
+ * the glyph whose coverage correlates best with the luminance of each cell.
+ * A negative correlation is as good as a positive one, it just swaps the
+ * colors. The colors are then averaged from the samples, weighted by the
+ * coverage of the glyph. In partly transparent cells, the opaque samples
+ * are matched instead, drawn in the foreground color.
+ */
+static void shape_row(
+    const struct renderer* r, int y, const struct sample* samples
+){
+    struct cell* row =
+        r->cv->cells + (size_t)(y - r->cell_y0) * r->cv->width;
+
+    for(int x = 0; x < r->cv->width; ++x)
+    {
+        const struct sample* cell = samples + x * GLYPH_ATLAS_WIDTH;
+        int16_t block[SHAPE_PIXELS];
+        int32_t dots[SHAPE_GLYPHS];
+        int64_t block_sq = 0;
+        int32_t block_sum = 0;
+        int opaque = 0;
+        int sum[3] = { 0, 0, 0 };
+
+        for(int i = 0; i < SHAPE_PIXELS; ++i)
+        {
+            const struct sample* s = cell +
+                (i / GLYPH_ATLAS_WIDTH) * r->grid_w + i % GLYPH_ATLAS_WIDTH;
+            if(s->a < ALPHA_THRESHOLD)
+            {
+                block[i] = -1;
+                continue;
+            }
+            block[i] = (77 * s->r + 150 * s->g + 29 * s->b) >> 12;
+            sum[0] += s->r;
+            sum[1] += s->g;
+            sum[2] += s->b;
+            opaque++;
+        }
+
+        if(opaque == 0)
+        {
+            clear_cell(row + x);
+            continue;
+        }
+        for(int i = 0; i < SHAPE_PIXELS; ++i)
+        {
+            if(opaque != SHAPE_PIXELS) block[i] = block[i] < 0 ? 0 : 255;
+            block_sum += block[i];
+            block_sq += block[i] * block[i];
+        }
+        kernels.correlate_glyphs(block, dots);
+
+        /* Compared as SHAPE_PIXELS^2 times covariance^2 / variance. */
+        int best = -1;
+        double best_fit = 0;
+        for(int g = 0; g < GLYPH_ATLAS_COUNT; ++g)
+        {
+            double cov = (double)SHAPE_PIXELS * dots[g] -
+                (double)block_sum * shape_sum[g];
+            if(opaque != SHAPE_PIXELS && cov <= 0) continue;
+            double fit = cov * fabs(cov) * shape_inv_var[g];
+            if(fabs(fit) > fabs(best_fit))
+            {
+                best = g;
+                best_fit = fit;
+            }
+        }
+        double block_var =
+            (double)SHAPE_PIXELS * block_sq - (double)block_sum * block_sum;
+
+        if(best < 0 || (
+            opaque == SHAPE_PIXELS &&
+            fabs(best_fit) < SHAPE_MIN_FIT * block_var
+        )){
+            int v[3], error[3];
+            for(int c = 0; c < 3; ++c)
+                v[c] = sum[c] / SHAPE_PIXELS +
+                    dither_offset(r->dither, x, y, c);
+            fill_cell(r, row + x, v, error);
+            continue;
+        }
+
+        /* The background gets the rest of the weight of each sample. */
+        int inverse = best_fit < 0;
+        int fg_sum[3] = { 0, 0, 0 }, bg_sum[3];
+        int fg_weight = 0, bg_weight;
+        for(int i = 0; i < SHAPE_PIXELS; ++i)
+        {
+            const struct sample* s = cell +
+                (i / GLYPH_ATLAS_WIDTH) * r->grid_w + i % GLYPH_ATLAS_WIDTH;
+            int w = shape_atlas[best][i];
+            if(inverse) w = 255 - w;
+            if(s->a < ALPHA_THRESHOLD) w = 0;
+            fg_sum[0] += w * s->r;
+            fg_sum[1] += w * s->g;
+            fg_sum[2] += w * s->b;
+            fg_weight += w;
+        }
+        for(int c = 0; c < 3; ++c) bg_sum[c] = 255 * sum[c] - fg_sum[c];
+        bg_weight = opaque == SHAPE_PIXELS ? 255 * opaque - fg_weight : 0;
+
+        row[x].ch = GLYPH_ATLAS_FIRST + best;
+        row[x].fg = weighted_color(r, x, y, fg_sum, fg_weight);
+        row[x].bg = weighted_color(r, x, y, bg_sum, bg_weight);
+    }
+}
+
+static void dither_row(
+    const struct renderer* r, int y, const struct sample* samples
+){
+    for(int x = 0; x < r->grid_w; ++x)
+    {
+        const struct sample* s = samples + x;
+        int v[3] = { s->r, s->g, s->b };
+        int error[3];
+
+        if(s->a < ALPHA_THRESHOLD)
+        {
+            put_sample(r, x, y, NULL, error);
+            continue;
+        }
+        for(int c = 0; c < 3; ++c)
+            v[c] += dither_offset(r->dither, x, y, c);
+        put_sample(r, x, y, v, error);
+    }
+}
+
+/* (x + 1, y - 1) is the last sample whose error reaches (x, y), so a row can
+ * diffuse sample x once the row above it has finished x + WAVEFRONT_LAG.
+ */
+#define WAVEFRONT_LAG 2
+
+static void wait_for_progress(atomic_int* progress, int samples)
+{
+    for(int spins = 0;
+        atomic_load_explicit(progress, memory_order_acquire) < samples;
+        ++spins
+    ) if(spins >= 64) sched_yield();
+}
+
+/* Floyd-Steinberg error diffusion over a row of the sample grid. err_in holds
+ * the error diffused into this row and err_out receives the error for the
+ * next one; both are indexed by 3 * x + channel and must have room for one
+ * extra sample on both sides.
+ *
+ * When rows are diffused in parallel, above is the progress counter of the
+ * previous row and done the one of this row. Both are NULL otherwise.
+ */
+static void diffuse_row(
+    const struct renderer* r,
+    int y,
+    const struct sample* samples,
+    const int* err_in,
+    int* err_out,
+    atomic_int* above,
+    atomic_int* done
+){
+    int w = r->grid_w;
+    int carry[3] = { 0, 0, 0 };
+    for(int x = 0; x < w; ++x)
+    {
+        const struct sample* s = samples + x;
+        int v[3] = { s->r, s->g, s->b };
+        int error[3];
+
+        if(above)
+            wait_for_progress(
+                above, x + WAVEFRONT_LAG < w ? x + WAVEFRONT_LAG : w
+            );
+
+        if(s->a < ALPHA_THRESHOLD)
+        {
+            put_sample(r, x, y, NULL, error);
+            carry[0] = carry[1] = carry[2] = 0;
+        }
+        else
+        {
+            for(int c = 0; c < 3; ++c) v[c] += err_in[3 * x + c] + carry[c];
+            put_sample(r, x, y, v, error);
+            for(int c = 0; c < 3; ++c)
+            {
+                carry[c] = 7 * error[c] / 16;
+                err_out[3 * (x - 1) + c] += 3 * error[c] / 16;
+                err_out[3 * x + c] += 5 * error[c] / 16;
+                err_out[3 * (x + 1) + c] += error[c] / 16;
+            }
+        }
+
+        if(done) atomic_store_explicit(done, x + 1, memory_order_release);
+    }
+}
+
+/* Renders cell rows [y0, y1). */
+static int render_rows(const struct renderer* r, int y0, int y1)
+{
+    size_t err_len = r->err_len;
+    struct sample* samples =
+        malloc(sizeof(struct sample) * r->grid_w * r->sub_h);
+    uint32_t* acc = NULL;
+    int* errors = r->errors;
+    int ret = 1;
+
+    if(!samples) goto end;
+    if(r->antialias)
+    {
+        acc = malloc(sample_scratch_size(r->img));
+        if(!acc) goto end;
+    }
+
+    for(int y = y0; r->block_row && y < y1; ++y)
+    {
+        for(int sy = 0; sy < r->sub_h; ++sy)
+            sample_row(r, y * r->sub_h + sy, samples + sy * r->grid_w, acc);
+        r->block_row(r, y, samples);
+    }
+
+    for(int y = y0 * r->sub_h; !r->block_row && y < y1 * r->sub_h; ++y)
+    {
+        sample_row(r, y, samples, acc);
+        if(errors)
+        {
+            int* err_in = errors + (y % r->err_slots) * err_len;
+            int* err_out = errors + ((y + 1) % r->err_slots) * err_len;
+            memset(err_out, 0, sizeof(int) * err_len);
+            diffuse_row(
+                r, y, samples, err_in + 3, err_out + 3, NULL, NULL
+            );
+        }
+        else dither_row(r, y, samples);
+        if(y % r->sub_h == r->sub_h - 1) finish_row(r, y / r->sub_h);
+    }
+    ret = 0;
+
+end:
+    free(samples);
+    free(acc);
+    return ret;
+}
+
+/* Calls fn(args + i * size) for each i in [0, count), each on its own thread.
+ * The calling thread takes the first call, and any whose thread couldn't be
+ * started once the others are running.
+ */
+static void run_parallel(
+    int count, void* (*fn)(void*), void* args, size_t size
+){
+    pthread_t* threads = malloc(sizeof(pthread_t) * count);
+    int* started = calloc(count, sizeof(int));
+
+    for(int i = 1; threads && started && i < count; ++i)
+        started[i] = pthread_create(
+            threads + i, NULL, fn, (char*)args + i * size
+        ) == 0;
+    fn(args);
+    for(int i = 1; i < count; ++i)
+    {
+        if(started && started[i]) pthread_join(threads[i], NULL);
+        else fn((char*)args + i * size);
+    }
+    free(threads);
+    free(started);
+}
+
+struct band
+{
+    const struct renderer* r;
+    int y0, y1;
+    int ret;
+};
+
+static void* render_band(void* arg)
+{
+    struct band* b = arg;
+    b->ret = render_rows(b->r, b->y0, b->y1);
+    return NULL;
+}
+
+/* Splits cell rows [y0, y1) into bands and renders each on its own thread. */
+static int render_bands(const struct renderer* r, int y0, int y1, int threads)
+{
+    struct band* bands = calloc(threads, sizeof(struct band));
+    int ret = 0;
+    if(!bands) return render_rows(r, y0, y1);
+
+    for(int i = 0; i < threads; ++i)
+    {
+        bands[i].r = r;
+        bands[i].y0 = y0 + (int)((int64_t)i * (y1 - y0) / threads);
+        bands[i].y1 = y0 + (int)((int64_t)(i + 1) * (y1 - y0) / threads);
+    }
+    run_parallel(threads, render_band, bands, sizeof(struct band));
+    for(int i = 0; i < threads; ++i) ret |= bands[i].ret;
+    free(bands);
+    return ret;
+}
+
+/* Parallel Floyd-Steinberg. Workers take rows of the sample grid in order
+ * from next_row, and each row trails the one above it by WAVEFRONT_LAG
+ * samples through the per-row progress counters. The arithmetic is the same
+ * as in render_rows(), so the result is identical to the serial one.
+ *
+ * At most one row per worker is in flight, and rows can only finish in
+ * order. So when a worker takes row y, every row up to y - workers is done,
+ * and workers + 1 error rows are enough to never clear one still in use.
+ * For the same reason, the worker finishing the last row of a cell row can
+ * pick its glyphs right away.
+ *
+ * Only the sample rows [first_row, end_row) are diffused. The rows above
+ * them are all done, so the first one doesn't wait for anything.
+ */
+struct wavefront
+{
+    const struct renderer* r;
+    int first_row, end_row;
+    atomic_int* progress;
+    atomic_int next_row;
+};
+
+static void* diffuse_rows(void* arg)
+{
+    struct wavefront* wf = *(struct wavefront**)arg;
+    const struct renderer* r = wf->r;
+    struct sample* samples = malloc(sizeof(struct sample) * r->grid_w);
+    uint32_t* acc = NULL;
+
+    if(r->antialias)
+        acc = malloc(sample_scratch_size(r->img));
+
+    /* Without scratch memory this worker just stays out of the way. */
+    if(samples && (acc || !r->antialias))
+    {
+        int y;
+        while((y = atomic_fetch_add(&wf->next_row, 1)) < wf->end_row)
+        {
+            int* err_in = r->errors + (y % r->err_slots) * r->err_len;
+            int* err_out = r->errors + ((y + 1) % r->err_slots) * r->err_len;
+            atomic_int* done = wf->progress + (y - wf->first_row);
+            sample_row(r, y, samples, acc);
+            memset(err_out, 0, sizeof(int) * r->err_len);
+            diffuse_row(
+                r, y, samples, err_in + 3, err_out + 3,
+                y > wf->first_row ? done - 1 : NULL,
+                done
+            );
+            if(y % r->sub_h == r->sub_h - 1) finish_row(r, y / r->sub_h);
+        }
+    }
+    free(samples);
+    free(acc);
+    return NULL;
+}
+
+/* Diffuses cell rows [y0, y1). The renderer must have at least threads + 1
+ * error rows.
+ */
+static int render_wavefront(
+    const struct renderer* r, int y0, int y1, int threads
+){
+    struct wavefront wf;
+    struct wavefront** args = malloc(sizeof(struct wavefront*) * threads);
+    int rows = (y1 - y0) * r->sub_h;
+    int ret = 1;
+
+    wf.r = r;
+    wf.first_row = y0 * r->sub_h;
+    wf.end_row = y1 * r->sub_h;
+    wf.progress = calloc(rows, sizeof(atomic_int));
+    atomic_init(&wf.next_row, wf.first_row);
+
+    if(args && wf.progress)
+    {
+        for(int i = 0; i < rows; ++i)
+            atomic_init(wf.progress + i, 0);
+        for(int i = 0; i < threads; ++i) args[i] = &wf;
+        run_parallel(threads, diffuse_rows, args, sizeof(*args));
+        /* Rows are only taken by workers that can finish them. */
+        ret = atomic_load(&wf.next_row) < wf.end_row;
+    }
+
+    free(args);
+    free(wf.progress);
+    return ret;
+}
+
+/* Renders cell rows [y0, y1), which must follow the ones rendered before
+ * when error diffusion is used.
+ */
+static int render_range(const struct renderer* r, int y0, int y1)
+{
+    int threads = r->threads;
+    if(threads > y1 - y0) threads = y1 - y0;
+    if(threads <= 1) return render_rows(r, y0, y1);
+    /* Error diffusion crosses band boundaries, so it can't be split. */
+    if(r->dither == DITHER_FSTEIN)
+        return render_wavefront(r, y0, y1, threads);
+    return render_bands(r, y0, y1, threads);
+}
+
+struct canvas* create_canvas(int width, int height)
+{
+    struct canvas* cv = malloc(sizeof(struct canvas));
+    if(!cv) return NULL;
+
+    cv->width = width;
+    cv->height = height;
+    cv->colors = COLOR_MODE_16;
+    cv->cells = malloc(sizeof(struct cell) * (size_t)width * height + 1);
+    if(!cv->cells)
+    {
+        free(cv);
+        return NULL;
+    }
+    for(size_t i = 0; i < (size_t)width * height; ++i)
+        clear_cell(cv->cells + i);
+    return cv;
+}
+
+void free_canvas(struct canvas* cv)
+{
+    if(!cv) return;
+    free(cv->cells);
+    free(cv);
+}
+
+/* The number of samples each cell is rendered from. */
+static void symbol_size(enum symbol_mode symbols, int* sub_w, int* sub_h)
+{
+    *sub_w = 1;
+    *sub_h = 1;
+    switch(symbols)
+    {
+    case SYMBOLS_ASCII: break;
+    case SYMBOLS_HALF: *sub_h = 2; break;
+    case SYMBOLS_BRAILLE: *sub_w = 2; *sub_h = 4; break;
+    case SYMBOLS_SEXTANT: *sub_w = 2; *sub_h = 3; break;
+    case SYMBOLS_SHAPES:
+        *sub_w = GLYPH_ATLAS_WIDTH;
+        *sub_h = GLYPH_ATLAS_HEIGHT;
+        break;
+    }
+}
+
+void render_resolution(
+    int width,
+    int height,
+    const struct render_options* opt,
+    int* sample_w,
+    int* sample_h
+){
+    int sub_w, sub_h;
+    symbol_size(opt->symbols, &sub_w, &sub_h);
+    *sample_w = width * sub_w;
+    *sample_h = height * sub_h;
+}
+
+int symbol_glyphs(enum symbol_mode symbols, uint32_t* glyphs)
+{
+    const uint32_t* patterns = NULL;
+    int patterns_count = 0;
+    int count = 0;
+
+    init_kernels();
+    switch(symbols)
+    {
+    case SYMBOLS_ASCII:
+    case SYMBOLS_SHAPES:
+        break;
+    case SYMBOLS_HALF:
+        glyphs[count++] = 0x2580;
+        glyphs[count++] = 0x2584;
+        break;
+    case SYMBOLS_BRAILLE:
+        patterns = braille_glyphs;
+        patterns_count = 256;
+        break;
+    case SYMBOLS_SEXTANT:
+        patterns = sextant_glyphs;
+        patterns_count = 64;
+        break;
+    }
+    for(int i = 0; i < patterns_count; ++i)
+        if(patterns[i] >= 0x80) glyphs[count++] = patterns[i];
+    return count;
+}
+
+/* Sets up a renderer for a width x height canvas, sampled from an image
+ * image_width pixels wide. The canvas and image are left for the caller.
+ * Returns non-zero on allocation failure.
+ */
+static int init_renderer(
+    struct renderer* r,
+    int width,
+    int height,
+    int image_width,
+    const struct render_options* opt
+){
+    float gamma = opt->gamma;
+
+    init_kernels();
+
+    r->cv = NULL;
+    r->img = NULL;
+    r->cell_y0 = 0;
+    r->img_y0 = 0;
+    r->opt = opt;
+    r->dither = opt->dither;
+    r->antialias = opt->antialias || opt->colors == COLOR_MODE_24BIT;
+    switch(opt->colors)
+    {
+    case COLOR_MODE_16: r->quantize = quantize_color_16; break;
+    case COLOR_MODE_256: r->quantize = quantize_color_256; break;
+    case COLOR_MODE_24BIT: r->quantize = quantize_color_24bit; break;
+    }
+    r->quantize_cell =
+        opt->exhaustive ? quantize_cell_exhaustive : quantize_cell;
+    r->block_row = NULL;
+    r->patterns = NULL;
+    symbol_size(opt->symbols, &r->sub_w, &r->sub_h);
+    switch(opt->symbols)
+    {
+    case SYMBOLS_ASCII:
+    case SYMBOLS_HALF:
+        break;
+    case SYMBOLS_BRAILLE:
+        r->block_row = pattern_row;
+        r->patterns = braille_glyphs;
+        break;
+    case SYMBOLS_SEXTANT:
+        r->block_row = pattern_row;
+        r->patterns = sextant_glyphs;
+        break;
+    case SYMBOLS_SHAPES:
+        r->block_row = shape_row;
+        break;
+    }
+    if(r->block_row && r->dither == DITHER_FSTEIN) r->dither = DITHER_NONE;
+    if(!r->patterns && opt->colors == COLOR_MODE_24BIT)
+        r->dither = DITHER_NONE;
+    r->grid_w = width * r->sub_w;
+    r->grid_h = height * r->sub_h;
+    r->columns = malloc(sizeof(int) * 2 * r->grid_w);
+    if(!r->columns) return 1;
+    for(int x = 0; x < r->grid_w; ++x)
+        cell_span(
+            x, r->grid_w, image_width,
+            r->columns + 2 * x, r->columns + 2 * x + 1
+        );
+    /* Like libcaca, a negative gamma inverts the image. */
+    r->invert = gamma < 0;
+    if(r->invert) gamma = -gamma;
+    for(int i = 0; i <= CHANNEL_MAX; ++i)
+        r->gammatab[i] = (int)(4096.0 * pow(i / 4096.0, 1.0 / gamma));
+
+    r->threads = opt->threads;
+    if(r->threads > height) r->threads = height;
+    r->errors = NULL;
+    r->err_slots = r->threads > 1 ? r->threads + 1 : 2;
+    r->err_len = 3 * (size_t)(r->grid_w + 2);
+    if(r->dither == DITHER_FSTEIN)
+    {
+        r->errors = calloc(r->err_slots * r->err_len, sizeof(int));
+        if(!r->errors)
+        {
+            free(r->columns);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void free_renderer(struct renderer* r)
+{
+    free(r->columns);
+    free(r->errors);
+}
+
+int render_image(
+    struct canvas* cv,
+    const struct image* img,
+    const struct render_options* opt
+){
+    struct renderer r;
+    int ret;
+
+    if(init_renderer(&r, cv->width, cv->height, img->width, opt)) return 1;
+    cv->colors = opt->colors;
+    r.cv = cv;
+    r.img = img;
+    ret = render_range(&r, 0, cv->height);
+    free_renderer(&r);
+    return ret;
+}
+
+/* Cell rows per thread in each band of a stream. */
+#define STREAM_BAND_ROWS 16
+
+struct render_stream
+{
+    struct renderer r;
+    struct render_options opt;
+    struct canvas band;
+    struct image img;
+    int height;
+    int band_rows;
+    /* First cell row of the next band. */
+    int y;
+    /* Source rows [first_row, first_row + row_count) of the next band. */
+    unsigned char* rows;
+    int first_row, row_count, row_capacity;
+    int (*emit)(void* user, const struct canvas* band, int y);
+    void* user;
+};
+
+/* Source rows [*from, *to) that cell rows [y0, y1) are sampled from. */
+static void stream_rows_needed(
+    const struct render_stream* s, int y0, int y1, int* from, int* to
+){
+    int unused;
+    cell_span(y0 * s->r.sub_h, s->r.grid_h, s->img.height, from, &unused);
+    cell_span(y1 * s->r.sub_h - 1, s->r.grid_h, s->img.height, &unused, to);
+}
+
+struct render_stream* create_render_stream(
+    int width,
+    int height,
+    int image_width,
+    int image_height,
+    enum pixel_format format,
+    const struct render_options* opt,
+    int (*emit)(void* user, const struct canvas* band, int y),
+    void* user
+){
+    struct render_stream* s = calloc(1, sizeof(struct render_stream));
+    if(!s) return NULL;
+
+    s->opt = *opt;
+    if(init_renderer(&s->r, width, height, image_width, &s->opt))
+    {
+        free(s);
+        return NULL;
+    }
+    s->band_rows = STREAM_BAND_ROWS * (s->r.threads > 1 ? s->r.threads : 1);
+    s->band.width = width;
+    s->band.colors = opt->colors;
+    s->band.cells =
+        malloc(sizeof(struct cell) * (size_t)width * s->band_rows + 1);
+    s->img.width = image_width;
+    s->img.height = image_height;
+    s->img.format = format;
+    s->height = height;
+    s->emit = emit;
+    s->user = user;
+    s->r.cv = &s->band;
+    s->r.img = &s->img;
+    if(!s->band.cells)
+    {
+        free_render_stream(s);
+        return NULL;
+    }
+    return s;
+}
+
+void free_render_stream(struct render_stream* s)
+{
+    if(!s) return;
+    free_renderer(&s->r);
+    free(s->band.cells);
+    free(s->rows);
+    free(s);
+}
+
+/* Renders and emits the next band, then drops the source rows that the
+ * following bands don't need.
+ */
+static int render_stream_band(struct render_stream* s)
+{
+    int y1 = s->y + s->band_rows;
+    if(y1 > s->height) y1 = s->height;
+
+    s->band.height = y1 - s->y;
+    s->img.data = s->rows;
+    s->r.cell_y0 = s->y;
+    s->r.img_y0 = s->first_row;
+    if(render_range(&s->r, s->y, y1)) return 1;
+    if(s->emit(s->user, &s->band, s->y)) return 1;
+    s->y = y1;
+
+    if(s->y < s->height)
+    {
+        int from, to;
+        stream_rows_needed(s, s->y, s->y + 1, &from, &to);
+        int drop = from - s->first_row;
+        if(drop > s->row_count) drop = s->row_count;
+        if(drop > 0)
+        {
+            size_t stride =
+                (size_t)s->img.width * pixel_size[s->img.format];
+            memmove(
+                s->rows, s->rows + drop * stride,
+                (s->row_count - drop) * stride
+            );
+            s->first_row += drop;
+            s->row_count -= drop;
+        }
+    }
+    return 0;
+}
+
+int render_stream_rows(
+    struct render_stream* s, const unsigned char* data, int y, int count
+){
+    size_t stride = (size_t)s->img.width * pixel_size[s->img.format];
+
+    for(int i = 0; i < count && s->y < s->height; ++i)
+    {
+        int from, to;
+        stream_rows_needed(s, s->y, s->y + 1, &from, &to);
+        if(y + i < from) continue;
+
+        if(s->row_count == 0) s->first_row = y + i;
+        if(s->row_count == s->row_capacity)
+        {
+            int capacity = s->row_capacity ? 2 * s->row_capacity : 64;
+            unsigned char* rows = realloc(s->rows, capacity * stride);
+            if(!rows) return 1;
+            s->rows = rows;
+            s->row_capacity = capacity;
+        }
+        memcpy(s->rows + s->row_count * stride, data + i * stride, stride);
+        s->row_count++;
+
+        for(;;)
+        {
+            int y1 = s->y + s->band_rows;
+            if(y1 > s->height) y1 = s->height;
+            stream_rows_needed(s, s->y, y1, &from, &to);
+            if(s->y >= s->height || s->first_row + s->row_count < to) break;
+            if(render_stream_band(s)) return 1;
+        }
+    }
+    return 0;
+}
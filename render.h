@@ -0,0 +1,225 @@
+/*
+ *  Copyright 2018 Julius Ikkala
+ *
+ *  This file is part of img2string.
+ *
+ *  img2string is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  img2string is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with img2string.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef IMG2STRING_RENDER_H
+#define IMG2STRING_RENDER_H
+#include <stddef.h>
+#include <stdint.h>
+
+enum dither_algorithm
+{
+    DITHER_NONE = 0,
+    DITHER_ORDERED2,
+    DITHER_ORDERED4,
+    DITHER_ORDERED8,
+    DITHER_RANDOM,
+    /* Thresholds from a tiled blue noise texture. Like the ordered dithers,
+     * every cell is dithered independently, but without a visible pattern.
+     */
+    DITHER_BLUENOISE,
+    DITHER_FSTEIN
+};
+
+enum color_mode
+{
+    /* Colors are indices to the 16 ANSI colors. */
+    COLOR_MODE_16 = 0,
+    /* Colors are indices to the xterm 256-color palette. Cells are filled by
+     * their background color alone.
+     */
+    COLOR_MODE_256,
+    /* Colors are 0xRRGGBB. Cells are filled by their background color alone,
+     * so nothing is dithered.
+     */
+    COLOR_MODE_24BIT
+};
+
+enum symbol_mode
+{
+    /* Characters from an ASCII ramp, picked by brightness. */
+    SYMBOLS_ASCII = 0,
+    /* Upper half blocks with the top pixel as the foreground color and the
+     * bottom pixel as the background color, doubling vertical resolution.
+     */
+    SYMBOLS_HALF,
+    /* Braille patterns, 2x4 dots per character. Each cell is split into
+     * samples brighter and darker than its mean, drawn in the foreground and
+     * background colors respectively. DITHER_FSTEIN has no effect.
+     */
+    SYMBOLS_BRAILLE,
+    /* Unicode 13 sextants, 2x3 blocks per character, split like
+     * SYMBOLS_BRAILLE.
+     */
+    SYMBOLS_SEXTANT,
+    /* ASCII characters picked by matching their shapes to the luminance of
+     * each cell, with the colors on both sides of the edge. Falls back to
+     * SYMBOLS_ASCII on flat cells. DITHER_FSTEIN has no effect.
+     */
+    SYMBOLS_SHAPES
+};
+
+/* The 16 ANSI colors, in the same order as libcaca's color enum. */
+enum color
+{
+    COLOR_BLACK = 0,
+    COLOR_BLUE,
+    COLOR_GREEN,
+    COLOR_CYAN,
+    COLOR_RED,
+    COLOR_MAGENTA,
+    COLOR_BROWN,
+    COLOR_LIGHTGRAY,
+    COLOR_DARKGRAY,
+    COLOR_LIGHTBLUE,
+    COLOR_LIGHTGREEN,
+    COLOR_LIGHTCYAN,
+    COLOR_LIGHTRED,
+    COLOR_LIGHTMAGENTA,
+    COLOR_YELLOW,
+    COLOR_WHITE,
+    COLOR_TRANSPARENT = 0xFFFFFFFF
+};
+
+/* ch is a Unicode code point. */
+struct cell
+{
+    uint32_t ch;
+    uint32_t fg;
+    uint32_t bg;
+};
+
+/* A grid of character cells, stored row by row. */
+struct canvas
+{
+    int width;
+    int height;
+    enum color_mode colors;
+    struct cell* cells;
+};
+
+/* Channel layouts of 8-bit pixels. Everything but PIXEL_RGBA is expanded to
+ * it the same way as stb_image does, with an opaque alpha if there is none.
+ */
+enum pixel_format
+{
+    PIXEL_RGBA = 0,
+    PIXEL_RGB,
+    PIXEL_BGRA,
+    PIXEL_BGR,
+    PIXEL_GRAY,
+    PIXEL_GRAY_ALPHA
+};
+
+/* 8-bit pixels. stride is the distance in bytes from one row to the next,
+ * negative for images stored bottom-up, or 0 if the rows are tightly packed.
+ * This lets uncompressed images be rendered straight from the file.
+ */
+struct image
+{
+    const unsigned char* data;
+    int width;
+    int height;
+    enum pixel_format format;
+    ptrdiff_t stride;
+};
+
+struct render_options
+{
+    float gamma;
+    enum dither_algorithm dither;
+    enum color_mode colors;
+    enum symbol_mode symbols;
+    int antialias;
+    /* With COLOR_MODE_16, picks the colors and glyph of each cell by trying
+     * every foreground/background pair instead of the closest background
+     * first.
+     */
+    int exhaustive;
+    /* Number of worker threads. The canvas is split into horizontal bands,
+     * one per thread, except with DITHER_FSTEIN where rows are diffused as a
+     * wavefront, each trailing the one above it by a couple of cells.
+     */
+    int threads;
+};
+
+/* Returns NULL if the canvas couldn't be allocated. The canvas starts out
+ * filled with transparent spaces.
+ */
+struct canvas* create_canvas(int width, int height);
+void free_canvas(struct canvas* cv);
+
+/* The size of the sample grid a width x height canvas is rendered from.
+ * Images are downscaled to it, so anything larger adds no detail.
+ */
+void render_resolution(
+    int width,
+    int height,
+    const struct render_options* opt,
+    int* sample_w,
+    int* sample_h
+);
+
+/* Writes the code points other than ASCII that cells rendered with the given
+ * symbols can hold into glyphs, which must have room for 256, and returns
+ * their count. No two of them have the same lowest byte.
+ */
+int symbol_glyphs(enum symbol_mode symbols, uint32_t* glyphs);
+
+/* Downscales the image to the size of the canvas and fills every cell with a
+ * character and a foreground/background color pair approximating it. Returns
+ * non-zero on allocation failure.
+ */
+int render_image(
+    struct canvas* cv,
+    const struct image* img,
+    const struct render_options* opt
+);
+
+/* Renders an image that arrives a few rows at a time, so that neither the
+ * image nor the canvas has to be held in memory as a whole. Only the source
+ * rows of the band of cell rows being rendered are kept.
+ */
+struct render_stream;
+
+/* Renders a width x height canvas from an image_width x image_height image
+ * of the given format. Every band of finished cell rows is passed to emit in
+ * order, as a canvas holding just that band, which starts at cell row y. emit
+ * returns non-zero to stop rendering. Returns NULL on allocation failure.
+ */
+struct render_stream* create_render_stream(
+    int width,
+    int height,
+    int image_width,
+    int image_height,
+    enum pixel_format format,
+    const struct render_options* opt,
+    int (*emit)(void* user, const struct canvas* band, int y),
+    void* user
+);
+void free_render_stream(struct render_stream* s);
+
+/* Feeds count rows of the image starting at row y, as tightly packed pixels
+ * of the stream's format. Rows must be fed in order, and each band is
+ * rendered and emitted as soon as its last row arrives. Returns non-zero on
+ * allocation failure or if emit stopped rendering.
+ */
+int render_stream_rows(
+    struct render_stream* s, const unsigned char* data, int y, int count
+);
+
+#endif